@@ -0,0 +1,155 @@
+/**
+ * @file parsing.bench.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese benchmarks measures parsing of responses and conversion to objects
+*/
+
+// Project includes
+#include <antybiurokrata/benchmarks/utils/benchbase.h>
+#include <antybiurokrata/libraries/html_scalpel/html_scalpel.h>
+#include <antybiurokrata/libraries/orm/orm.h>
+
+namespace benchmarks
+{
+	using namespace core;
+
+	namespace detail
+	{
+		/**
+		 * @brief parses JSON fixture
+		 *
+		 * @param text content of fixture
+		 * @return Json::Value
+		 */
+		inline Json::Value parse_json(const str& text)
+		{
+			Json::Value result;
+			Json::CharReaderBuilder builder;
+			std::unique_ptr<Json::CharReader> reader{builder.newCharReader()};
+			str errors;
+			dassert(reader->parse(text.data(), text.data() + text.size(), &result, &errors),
+					  "invalid json fixture: "_u8 + errors);
+			return result;
+		}
+
+		/**
+		 * @brief creates persons extractor, that knows owner of JSON fixtures, as in `universal_getter`
+		 *
+		 * @return std::unique_ptr<orm::persons_extractor_t>
+		 */
+		inline std::unique_ptr<orm::persons_extractor_t> make_json_persons_extractor(
+			 const str_v& orcid)
+		{
+			std::unique_ptr<orm::persons_extractor_t> result{new orm::persons_extractor_t{}};
+			objects::shared_person_t person{};
+			(*person())().orcid(objects::detail::detail_orcid_t::from_string(orcid));
+			result->persons->insert(person);
+			return result;
+		}
+
+		/**
+		 * @brief visits every record with new publications extractor
+		 *
+		 * @param records output of adapter
+		 * @param persons persons extractor used by publications extractor
+		 * @return size_t amount of extracted publications
+		 */
+		template<typename records_t>
+		inline size_t extract(records_t& records, orm::persons_extractor_t& persons)
+		{
+			orm::publications_extractor_t publications{persons};
+			for(auto& record: records) record.accept(&publications);
+			return publications.publications.size();
+		}
+	}	 // namespace detail
+
+	const registrar bgpolsl_benchmarks{"bgpolsl", [](context_t& ctx) {
+		constexpr str_v match_expresion{R"(name="label_id">IDT:)"};
+		const str body{ctx.fixture("bgpolsl.html")};
+
+		std::vector<str> lines;
+		for(str_v line: string_utils::split_words<str_v>{body, '\n'})
+			if(line.find(match_expresion) != str_v::npos) lines.emplace_back(line);
+
+		// words are views, so every line needs its own buffer
+		std::vector<str> buffers{lines};
+		std::vector<std::vector<str_v>> words(lines.size());
+		for(size_t i = 0; i < lines.size(); ++i) html_scalpel(buffers[i], words[i]);
+
+		ctx.measure("html_scalpel", [&] {
+			size_t result = 0ul;
+			str buffer;
+			std::vector<str_v> output;
+			for(const str& line: lines)
+			{
+				buffer.assign(line);
+				output.clear();
+				html_scalpel(buffer, output);
+				result += output.size();
+			}
+			return result;
+		});
+
+		ctx.measure("bgpolsl_repr_t", [&] {
+			std::list<network::detail::bgpolsl_repr_t> records;
+			for(const auto& w: words) records.emplace_back(w);
+			return records.size();
+		});
+
+		ctx.measure("bgpolsl_adapter::parse", [&] {
+			return network::bgpolsl_adapter::parse(body)->size();
+		});
+
+		ctx.measure("bgpolsl_stream_parser_t (4 KiB chunks)", [&] {
+			constexpr size_t chunk_size = 4096ul;
+			size_t result					 = 0ul;
+			network::detail::bgpolsl_stream_parser_t parser{
+				 [&](network::detail::bgpolsl_repr_t&&) { ++result; }};
+			for(size_t pos = 0; pos < body.size(); pos += chunk_size)
+				parser.feed(str_v{body}.substr(pos, chunk_size));
+			parser.finish();
+			return result;
+		});
+
+		auto records = network::bgpolsl_adapter::parse(body);
+		ctx.measure("orm::bgpolsl", [&] {
+			orm::persons_extractor_t persons{};
+			return detail::extract(*records, persons);
+		});
+	}};
+
+	const registrar json_benchmarks{"json", [](context_t& ctx) {
+		constexpr str_v orcid{"0000-0002-1825-0097"};
+		const Json::Value orcid_json{detail::parse_json(ctx.fixture("orcid_works.json"))};
+		const Json::Value scopus_json{detail::parse_json(ctx.fixture("scopus_search.json"))};
+
+		ctx.measure("orcid_adapter::parse_works", [&] {
+			size_t result = 0ul;
+			network::orcid_adapter::parse_works(orcid_json, str{orcid},
+															[&](auto& page) { result += page.size(); });
+			return result;
+		});
+
+		ctx.measure("scopus_adapter::parse_page", [&] {
+			size_t total = 0ul;
+			return network::scopus_adapter::parse_page(scopus_json, str{orcid}, total).size();
+		});
+
+		network::orcid_adapter::value_t orcid_records;
+		network::orcid_adapter::parse_works(orcid_json, str{orcid}, [&](auto& page) {
+			orcid_records.splice(orcid_records.end(), page);
+		});
+		size_t total = 0ul;
+		auto scopus_records = network::scopus_adapter::parse_page(scopus_json, str{orcid}, total);
+
+		ctx.measure("orm::orcid", [&] {
+			auto persons = detail::make_json_persons_extractor(orcid);
+			return detail::extract(orcid_records, *persons);
+		});
+
+		ctx.measure("orm::scopus", [&] {
+			auto persons = detail::make_json_persons_extractor(orcid);
+			return detail::extract(scopus_records, *persons);
+		});
+	}};
+}	 // namespace benchmarks
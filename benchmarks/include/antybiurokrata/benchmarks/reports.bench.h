@@ -0,0 +1,80 @@
+/**
+ * @file reports.bench.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese benchmarks measures comparison of publications and report generation
+*/
+
+// Project includes
+#include <antybiurokrata/benchmarks/utils/benchbase.h>
+#include <antybiurokrata/libraries/summary/summary.h>
+#include <antybiurokrata/libraries/generator/generator.h>
+
+namespace benchmarks
+{
+	using namespace core;
+
+	namespace detail
+	{
+		/**
+		 * @brief compares two synthetic inputs with reference, the same way as engine does
+		 *
+		 * @param pool shared workers
+		 * @param reference reference publications
+		 * @param scopus first input
+		 * @param orcid second input
+		 * @return reports::report_t
+		 */
+		inline reports::report_t compare(std::shared_ptr<patterns::thread_pool> pool,
+													const std::vector<objects::shared_publication_t>& reference,
+													const std::vector<objects::shared_publication_t>& scopus,
+													const std::vector<objects::shared_publication_t>& orcid)
+		{
+			reports::report_t result{};
+			{
+				reports::summary sum{pool};
+				sum.activate(reference);
+				sum.on_done.register_slot([&](reports::report_t ptr) { result = ptr; });
+				sum.process(scopus, objects::match_type::SCOPUS);
+				sum.process(orcid, objects::match_type::ORCID);
+			}
+			check_nullptr{result};
+			return result;
+		}
+	}	 // namespace detail
+
+	const registrar reports_benchmarks{"reports", [](context_t& ctx) {
+		const size_t size = ctx.options().size;
+		std::shared_ptr<patterns::thread_pool> pool{new patterns::thread_pool{}};
+
+		const auto reference = synthetic_publications(size, 1ul);
+		const auto scopus	  = synthetic_input(reference, 2ul);
+		const auto orcid	  = synthetic_input(reference, 3ul);
+
+		ctx.measure("summary::process", [&] {
+			return detail::compare(pool, reference, scopus, orcid)->size();
+		});
+
+		ctx.measure("summary::process (exact only)", [&] {
+			reports::report_t result{};
+			{
+				reports::summary sum{pool};
+				sum.fuzzy_ratio(0.0);
+				sum.activate(reference);
+				sum.on_done.register_slot([&](reports::report_t ptr) { result = ptr; });
+				sum.process(scopus, objects::match_type::SCOPUS);
+				sum.process(orcid, objects::match_type::ORCID);
+			}
+			return result->size();
+		});
+
+		const reports::report_t report = detail::compare(pool, reference, scopus, orcid);
+		const std::filesystem::path output{std::filesystem::temp_directory_path()
+													  / "antybiurokrata_bench.xlsx"};
+		ctx.measure("generator::process", [&] {
+			reports::generator gen{report, output.string(), [] {}, [](size_t) {}};
+			gen.process();
+			return report->size();
+		});
+		std::filesystem::remove(output);
+	}};
+}	 // namespace benchmarks
@@ -0,0 +1,175 @@
+/**
+ * @file benchbase.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains minimal framework for performance measurements
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+// STL
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+// Project includes
+#include <antybiurokrata/libraries/logger/logger.h>
+#include <antybiurokrata/libraries/objects/objects.h>
+#include <antybiurokrata/types.hpp>
+
+namespace core
+{
+	namespace benchbase
+	{
+		struct benchbase_logger : public Log<benchbase_logger>
+		{
+			using Log<benchbase_logger>::get_logger;
+		};
+
+		/** @brief options of whole run, set from command line */
+		struct options_t
+		{
+			/** @brief directory with recorded responses */
+			std::filesystem::path fixtures{"fixtures"};
+
+			/** @brief amount of synthetic publications in reference set */
+			size_t size{2'000ul};
+
+			/** @brief every measurement is repeated at least this amount of times */
+			size_t min_iterations{10ul};
+
+			/** @brief every measurement is repeated for at least this time */
+			std::chrono::milliseconds min_time{500};
+
+			/** @brief only measurements which names contains this string are performed */
+			str filter{};
+
+			/** @brief where to save results, if empty standard output is used */
+			std::filesystem::path output{};
+		};
+
+		/** @brief results of one measurement, times are in nanoseconds */
+		struct result_t
+		{
+			str name;
+			size_t iterations;
+			size_t items;
+			double mean;
+			double median;
+			double min;
+			double max;
+		};
+
+		/**
+		 * @brief passed to every benchmark, provides input data and performs measurements
+		 */
+		class context_t
+		{
+			const options_t& m_options;
+			std::vector<result_t>& m_results;
+
+		 public:
+			context_t(const options_t& options, std::vector<result_t>& results) :
+				 m_options{options}, m_results{results}
+			{
+			}
+
+			/** @brief options of current run */
+			const options_t& options() const noexcept { return m_options; }
+
+			/**
+			 * @brief reads whole fixture file
+			 *
+			 * @param filename name of file in fixtures directory
+			 * @return str content of file
+			 * @throw assert_exception if file cannot be read
+			 */
+			str fixture(const str_v& filename) const;
+
+			/**
+			 * @brief checks is measurement with given name has to be performed
+			 *
+			 * @param name name of measurement
+			 */
+			bool enabled(const str_v& name) const
+			{
+				return m_options.filter.empty() || name.find(m_options.filter) != str_v::npos;
+			}
+
+			/**
+			 * @brief repeats given function at least `min_iterations` times and at least for `min_time`
+			 *
+			 * @param name name of measurement, saved in results
+			 * @param fun measured function, returns amount of processed items
+			 */
+			void measure(const str_v& name, const std::function<size_t()>& fun);
+		};
+
+		using benchmark_function_t = std::function<void(context_t&)>;
+
+		/** @brief all registered benchmarks, in order of registration */
+		std::vector<std::pair<str, benchmark_function_t>>& registry();
+
+		/**
+		 * @brief registers benchmark in global registry, create it as global constant
+		 */
+		struct registrar
+		{
+			registrar(const str_v& name, benchmark_function_t fun)
+			{
+				registry().emplace_back(str{name}, std::move(fun));
+			}
+		};
+
+		/**
+		 * @brief parses command line, runs all registered benchmarks and saves results
+		 *
+		 * @param argc from main
+		 * @param argv from main
+		 * @param revision version of sources, saved in results
+		 * @return int exit code
+		 */
+		int run(const int argc, const char** argv, const str_v& revision);
+
+		/**
+		 * @brief saves results as JSON
+		 *
+		 * @param os output stream
+		 * @param revision version of sources
+		 * @param options options of run
+		 * @param results results of measurements
+		 */
+		void write_json(std::ostream& os, const str_v& revision, const options_t& options,
+							 const std::vector<result_t>& results);
+
+		/**
+		 * @brief generates reproducible set of publications, with unique titles and DOIs
+		 *
+		 * @param count amount of publications
+		 * @param seed seed of generator
+		 * @return std::vector<objects::shared_publication_t>
+		 */
+		std::vector<objects::shared_publication_t> synthetic_publications(const size_t count,
+																								const size_t seed);
+
+		/**
+		 * @brief generates input for comparison with given reference: quarter of publications is
+		 * copied exactly, quarter differs only in typos in title and rest is unique
+		 *
+		 * @param reference reference set
+		 * @param seed seed of generator
+		 * @return std::vector<objects::shared_publication_t>
+		 */
+		std::vector<objects::shared_publication_t> synthetic_input(
+			 const std::vector<objects::shared_publication_t>& reference, const size_t seed);
+	}	 // namespace benchbase
+}	 // namespace core
+
+namespace benchmarks
+{
+	using namespace core::benchbase;
+	extern logger& log;
+}	 // namespace benchmarks
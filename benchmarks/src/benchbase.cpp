@@ -0,0 +1,241 @@
+#include <antybiurokrata/benchmarks/utils/benchbase.h>
+
+// STL
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace core
+{
+	namespace benchbase
+	{
+		str context_t::fixture(const str_v& filename) const
+		{
+			const std::filesystem::path path{m_options.fixtures / filename};
+			std::ifstream file{path, std::ios::binary};
+			dassert(file.is_open(), "cannot open fixture: "_u8 + path.string());
+
+			std::stringstream ss;
+			ss << file.rdbuf();
+			return ss.str();
+		}
+
+		void context_t::measure(const str_v& name, const std::function<size_t()>& fun)
+		{
+			using clock_t = std::chrono::steady_clock;
+			if(!enabled(name)) return;
+
+			// one run, not measured, to fill caches and lazy initialized structures
+			volatile size_t sink = fun();
+
+			std::vector<double> samples;
+			samples.reserve(m_options.min_iterations);
+			const auto deadline = clock_t::now() + m_options.min_time;
+			size_t items		  = 0ul;
+			while(samples.size() < m_options.min_iterations || clock_t::now() < deadline)
+			{
+				const auto start = clock_t::now();
+				items				  = fun();
+				const auto stop  = clock_t::now();
+				sink				  = sink + items;
+				samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+			}
+
+			std::sort(samples.begin(), samples.end());
+			double sum = 0.0;
+			for(const double x: samples) sum += x;
+
+			result_t result{.name		  = str{name},
+								 .iterations = samples.size(),
+								 .items		  = items,
+								 .mean		  = sum / static_cast<double>(samples.size()),
+								 .median		  = samples[samples.size() / 2ul],
+								 .min			  = samples.front(),
+								 .max			  = samples.back()};
+
+			benchmarks::log.info() << name << ": " << result.median / 1'000'000.0 << " ms ("
+										  << result.iterations << " iterations)" << logger::endl;
+			m_results.emplace_back(std::move(result));
+		}
+
+		std::vector<std::pair<str, benchmark_function_t>>& registry()
+		{
+			static std::vector<std::pair<str, benchmark_function_t>> benchmarks;
+			return benchmarks;
+		}
+
+		int run(const int argc, const char** argv, const str_v& revision)
+		{
+			options_t options{};
+			for(int i = 1; i + 1 < argc; i += 2)
+			{
+				const str_v key{argv[i]};
+				const str_v value{argv[i + 1]};
+				if(key == "--fixtures") options.fixtures = value;
+				else if(key == "--size")
+					options.size = std::stoul(str{value});
+				else if(key == "--iterations")
+					options.min_iterations = std::stoul(str{value});
+				else if(key == "--time")
+					options.min_time = std::chrono::milliseconds{std::stoul(str{value})};
+				else if(key == "--filter")
+					options.filter = value;
+				else if(key == "--output")
+					options.output = value;
+				else
+				{
+					benchmarks::log.error() << "unknown option: " << key << logger::endl;
+					return 1;
+				}
+			}
+			options.min_iterations = std::max(options.min_iterations, 1ul);
+
+			std::vector<result_t> results;
+			context_t context{options, results};
+			for(auto& benchmark: registry())
+			{
+				benchmarks::log.info() << "running `" << benchmark.first << "` benchmarks"
+											  << logger::endl;
+				logger::switch_log_level_keeper<logger::log_level::NONE> _;
+				benchmark.second(context);
+			}
+
+			if(options.output.empty()) write_json(std::cout, revision, options, results);
+			else
+			{
+				std::ofstream file{options.output};
+				write_json(file, revision, options, results);
+			}
+			return 0;
+		}
+
+		void write_json(std::ostream& os, const str_v& revision, const options_t& options,
+							 const std::vector<result_t>& results)
+		{
+			// names and revision are plain ascii, only quotes and backslashes require escaping
+			const auto quoted = [](const str_v& v) {
+				str result{"\""};
+				for(const char c: v)
+				{
+					if(c == '"' || c == '\\') result += '\\';
+					result += c;
+				}
+				return result + "\"";
+			};
+
+			os << "{\n";
+			os << "\t\"revision\": " << quoted(revision) << ",\n";
+			os << "\t\"size\": " << options.size << ",\n";
+			os << "\t\"benchmarks\": [";
+			for(size_t i = 0; i < results.size(); ++i)
+			{
+				const result_t& r = results[i];
+				os << (i == 0 ? "\n" : ",\n");
+				os << "\t\t{ \"name\": " << quoted(r.name) << ", \"iterations\": " << r.iterations
+					<< ", \"items\": " << r.items << ", \"mean_ns\": " << r.mean
+					<< ", \"median_ns\": " << r.median << ", \"min_ns\": " << r.min
+					<< ", \"max_ns\": " << r.max << ", \"items_per_second\": "
+					<< (r.median > 0.0 ? static_cast<double>(r.items) * 1e9 / r.median : 0.0) << " }";
+			}
+			os << "\n\t]\n}\n";
+		}
+
+		namespace
+		{
+			constexpr std::array<str_v, 24> dictionary{
+				 "ANALYSIS",	  "OF",			  "THE",		  "METHOD",		 "FOR",			"DYNAMIC",
+				 "MODEL",		  "CONTROL",	  "SYSTEMS",  "NEURAL",		 "NETWORK",		"BASED",
+				 "OPTIMIZATION", "STEEL",		  "THERMAL",  "PROPERTIES",	 "APPLICATION", "IN",
+				 "DISTRIBUTED",  "ALGORITHM",	  "SILESIA",  "MEASUREMENT", "ENERGY",		"STRUCTURE"};
+
+			constexpr uint16_t first_year = 2000;
+			constexpr uint16_t years		= 22;
+
+			/** @brief creates publication with given fields */
+			objects::shared_publication_t make_publication(const u16str& title, const uint16_t year,
+																		  const objects::id_type id,
+																		  const u16str& id_value)
+			{
+				objects::shared_publication_t spub{new objects::publication_t{}};
+				objects::publication_t& pub = *spub();
+				pub().title(title);
+				pub().year(year);
+				pub().ids()().data()[id] = id_value;
+				pub().update_fingerprint();
+				return spub;
+			}
+		}	 // namespace
+
+		std::vector<objects::shared_publication_t> synthetic_publications(const size_t count,
+																								const size_t seed)
+		{
+			std::mt19937_64 engine{seed};
+			std::uniform_int_distribution<size_t> word{0ul, dictionary.size() - 1ul};
+			std::uniform_int_distribution<size_t> words{4ul, 14ul};
+			std::uniform_int_distribution<uint16_t> year{first_year, first_year + years - 1};
+
+			std::vector<objects::shared_publication_t> result;
+			result.reserve(count);
+			for(size_t i = 0; i < count; ++i)
+			{
+				// number makes every title unique
+				str title{std::to_string(i)};
+				for(size_t w = words(engine); w > 0; --w)
+				{
+					title += ' ';
+					title += dictionary[word(engine)];
+				}
+
+				const str doi{"10." + std::to_string(seed) + "/" + std::to_string(i)};
+				result.emplace_back(make_publication(transcoding::to_utf16(title), year(engine),
+																 objects::id_type::DOI,
+																 transcoding::to_utf16(doi)));
+			}
+			return result;
+		}
+
+		std::vector<objects::shared_publication_t> synthetic_input(
+			 const std::vector<objects::shared_publication_t>& reference, const size_t seed)
+		{
+			if(reference.empty()) return {};
+
+			std::mt19937_64 engine{seed};
+			std::uniform_int_distribution<size_t> position{0ul, reference.size() - 1ul};
+			std::uniform_int_distribution<int> letter{'A', 'Z'};
+
+			const size_t quarter = reference.size() / 4ul;
+			std::vector<objects::shared_publication_t> result
+				 = synthetic_publications(reference.size() - 2ul * quarter, seed);
+
+			for(size_t i = 0; i < 2ul * quarter; ++i)
+			{
+				const objects::publication_t& ref = *reference[position(engine)]();
+				u16str title{ref().title()().data()};
+				const uint16_t year = ref().year();
+
+				if(i < quarter)	  // exact copy, with the same DOI
+				{
+					result.emplace_back(make_publication(title, year, objects::id_type::DOI,
+																	 (*ref().ids()()->begin()).second().data()));
+					continue;
+				}
+
+				// the same title with single typo, and id of another kind
+				if(!title.empty())
+					title[std::uniform_int_distribution<size_t>{0ul, title.size() - 1ul}(engine)]
+						 = static_cast<u16char_t>(letter(engine));
+				const u16str eid = transcoding::to_utf16("2-s2.0-" + std::to_string(i));
+				result.emplace_back(make_publication(title, year, objects::id_type::EID, eid));
+			}
+
+			std::shuffle(result.begin(), result.end(), engine);
+			return result;
+		}
+	}	 // namespace benchbase
+}	 // namespace core
+
+namespace benchmarks
+{
+	logger& log = core::benchbase::benchbase_logger::get_logger();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file character_tables.hpp
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains locale independent classification and case mapping of characters
+ *
+ * @copyright Copyright (c) 2021
+ *
+*/
+
+#pragma once
+
+// STL
+#include <array>
+#include <cstdint>
+
+namespace core
+{
+	/**
+	 * @brief classification and case mapping, that does not depend on installed locales; Latin-1 and
+	 * Latin Extended-A (so all polish letters) are served from static table, latin extended-B, greek
+	 * and cyrillic are recognized by ranges, rest of characters are neither letters nor digits
+	 */
+	namespace characters
+	{
+		namespace detail
+		{
+			/** @brief flags of single character */
+			enum flag_t : uint8_t
+			{
+				ALPHA = 1 << 0,
+				DIGIT = 1 << 1,
+				UPPER = 1 << 2
+			};
+
+			/** @brief information about single character */
+			struct entry_t
+			{
+				uint8_t flags;
+				char16_t upper;
+			};
+
+			/** @brief Latin-1 and Latin Extended-A */
+			constexpr char32_t table_limit = 0x0180;
+
+			/** @brief marks given pair of characters as upper and lower case letter */
+			constexpr void set_pair(std::array<entry_t, table_limit>& table, const char16_t upper,
+											const char16_t lower) noexcept
+			{
+				table[upper] = entry_t{ALPHA | UPPER, upper};
+				table[lower] = entry_t{ALPHA, upper};
+			}
+
+			/** @brief classification of characters in range [0; table_limit) */
+			constexpr std::array<entry_t, table_limit> table = [] {
+				std::array<entry_t, table_limit> result{};
+				for(char16_t c = 0; c < table_limit; ++c) result[c] = entry_t{0, c};
+
+				for(char16_t c = u'0'; c <= u'9'; ++c) result[c].flags = DIGIT;
+				for(char16_t c = u'A'; c <= u'Z'; ++c) set_pair(result, c, c + 0x20);
+
+				// Latin-1: ordinal indicators, micro sign, letters without multiplication and division signs
+				result[0x00AA] = entry_t{ALPHA, 0x00AA};
+				result[0x00B5] = entry_t{ALPHA, 0x039C};
+				result[0x00BA] = entry_t{ALPHA, 0x00BA};
+				for(char16_t c = 0x00C0; c <= 0x00DE; ++c)
+					if(c != 0x00D7) set_pair(result, c, c + 0x20);
+				result[0x00DF] = entry_t{ALPHA, 0x00DF};
+				result[0x00FF] = entry_t{ALPHA, 0x0178};
+
+				// Latin Extended-A: mostly pairs, upper case first
+				for(char16_t c = 0x0100; c < 0x0138; c += 2) set_pair(result, c, c + 1);
+				result[0x0131] = entry_t{ALPHA, u'I'};	  // dotless i
+				result[0x0138] = entry_t{ALPHA, 0x0138};	  // kra
+				for(char16_t c = 0x0139; c < 0x0149; c += 2) set_pair(result, c, c + 1);
+				result[0x0149] = entry_t{ALPHA, 0x0149};	  // n preceded by apostrophe
+				for(char16_t c = 0x014A; c < 0x0178; c += 2) set_pair(result, c, c + 1);
+				result[0x0178] = entry_t{ALPHA | UPPER, 0x0178};
+				for(char16_t c = 0x0179; c < 0x017F; c += 2) set_pair(result, c, c + 1);
+				result[0x017F] = entry_t{ALPHA, u'S'};	  // long s
+
+				return result;
+			}();
+
+			/** @brief letters above `table_limit`: latin extended-B, greek and cyrillic */
+			constexpr bool is_extended_alpha(const char32_t c) noexcept
+			{
+				// Latin Extended-B
+				if(c <= 0x024F) return true;
+
+				// Greek, without ano teleia and reversed lunate epsilon symbol
+				if(c >= 0x0386 && c <= 0x03FF) return c != 0x0387 && c != 0x03F6;
+
+				// Cyrillic, without thousands sign and combining marks
+				if(c >= 0x0400 && c <= 0x052F) return c < 0x0482 || c > 0x0489;
+
+				return false;
+			}
+
+			/** @brief upper case of greek and basic cyrillic letters, rest is not changed */
+			constexpr char32_t extended_upper(const char32_t c) noexcept
+			{
+				if(c == 0x03C2) return 0x03A3;	  // final sigma
+				if(c >= 0x03B1 && c <= 0x03CB && c != 0x03C2) return c - 0x20;
+				if(c == 0x03AC) return 0x0386;	  // greek letters with tonos
+				if(c >= 0x03AD && c <= 0x03AF) return c - 0x25;
+				if(c == 0x03CC) return 0x038C;
+				if(c >= 0x03CD && c <= 0x03CE) return c - 0x3F;
+				if(c >= 0x0430 && c <= 0x044F) return c - 0x20;
+				if(c >= 0x0450 && c <= 0x045F) return c - 0x50;
+				return c;
+			}
+		}	 // namespace detail
+
+		/** @brief is given character a letter */
+		constexpr bool is_alpha(const char32_t c) noexcept
+		{
+			if(c < detail::table_limit) return detail::table[c].flags & detail::ALPHA;
+			return detail::is_extended_alpha(c);
+		}
+
+		/** @brief is given character an ASCII digit */
+		constexpr bool is_digit(const char32_t c) noexcept { return c >= U'0' && c <= U'9'; }
+
+		/** @brief is given character a letter or a digit */
+		constexpr bool is_alnum(const char32_t c) noexcept
+		{
+			if(c < detail::table_limit)
+				return detail::table[c].flags & (detail::ALPHA | detail::DIGIT);
+			return detail::is_extended_alpha(c);
+		}
+
+		/** @brief is given character an upper case letter */
+		constexpr bool is_upper(const char32_t c) noexcept
+		{
+			if(c < detail::table_limit) return detail::table[c].flags & detail::UPPER;
+			return (c >= 0x0391 && c <= 0x03AB) || (c >= 0x0400 && c <= 0x042F);
+		}
+
+		/** @brief upper case of given character, or character itself if there is no upper case */
+		constexpr char32_t to_upper(const char32_t c) noexcept
+		{
+			if(c < detail::table_limit) return detail::table[c].upper;
+			return detail::extended_upper(c);
+		}
+
+		/** @brief same as above, for code units, that are not part of surrogate pair */
+		constexpr char16_t to_upper(const char16_t c) noexcept
+		{
+			return static_cast<char16_t>(to_upper(static_cast<char32_t>(c)));
+		}
+	}	 // namespace characters
+}	 // namespace core
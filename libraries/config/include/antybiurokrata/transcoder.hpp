@@ -0,0 +1,95 @@
+/**
+ * @file transcoder.hpp
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains fast conversions between UTF-8 and UTF-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+*/
+
+#pragma once
+
+// STL
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace core
+{
+	/**
+	 * @brief conversions between UTF-8 and UTF-16, without any setup per call; behaves as previously
+	 * used `std::codecvt<char16_t, char>` from libstdc++: invalid input (stray continuation bytes,
+	 * C0/C1 and F5..FF leads, overlong sequences, lone low surrogates, code points above U+10FFFF)
+	 * is rejected, but last character, that is too short for its lead, is silently dropped, without
+	 * checking its continuation bytes
+	 */
+	namespace transcoding
+	{
+		/** @brief returned by `to_utf8` for invalid input, same as by previously used `std::wstring_convert` */
+		constexpr std::string_view error_utf8{"Error"};
+
+		/** @brief returned by `to_utf16` for invalid input, same as by previously used `std::wstring_convert` */
+		constexpr std::u16string_view error_utf16{u"Error"};
+
+		/** @brief size of buffer, that is always enough for UTF-16 version of UTF-8 input with given size */
+		constexpr size_t max_utf16_length(const size_t utf8_length) noexcept { return utf8_length; }
+
+		/** @brief size of buffer, that is always enough for UTF-8 version of UTF-16 input with given size */
+		constexpr size_t max_utf8_length(const size_t utf16_length) noexcept
+		{
+			return 3ul * utf16_length;
+		}
+
+		/**
+		 * @brief converts UTF-8 to UTF-16 into caller buffer
+		 *
+		 * @param input UTF-8 text
+		 * @param output buffer for at least `max_utf16_length(input.size())` code units
+		 * @return std::optional<size_t> amount of written code units, or nothing if input is invalid
+		 */
+		std::optional<size_t> utf8_to_utf16(const std::string_view input, char16_t* output) noexcept;
+
+		/**
+		 * @brief converts UTF-16 to UTF-8 into caller buffer
+		 *
+		 * @param input UTF-16 text
+		 * @param output buffer for at least `max_utf8_length(input.size())` bytes
+		 * @return std::optional<size_t> amount of written bytes, or nothing if input is invalid
+		 */
+		std::optional<size_t> utf16_to_utf8(const std::u16string_view input, char* output) noexcept;
+
+		/**
+		 * @brief appends UTF-16 version of input to output, allows to reuse buffers
+		 *
+		 * @param input UTF-8 text
+		 * @param output output, not changed if input is invalid
+		 * @return true on success
+		 */
+		bool append_utf16(const std::string_view input, std::u16string& output);
+
+		/**
+		 * @brief appends UTF-8 version of input to output, allows to reuse buffers
+		 *
+		 * @param input UTF-16 text
+		 * @param output output, not changed if input is invalid
+		 * @return true on success
+		 */
+		bool append_utf8(const std::u16string_view input, std::string& output);
+
+		/**
+		 * @brief converts UTF-8 to UTF-16
+		 *
+		 * @param input UTF-8 text
+		 * @return std::u16string converted text or `error_utf16`
+		 */
+		std::u16string to_utf16(const std::string_view input);
+
+		/**
+		 * @brief converts UTF-16 to UTF-8
+		 *
+		 * @param input UTF-16 text
+		 * @return std::string converted text or `error_utf8`
+		 */
+		std::string to_utf8(const std::u16string_view input);
+	}	 // namespace transcoding
+}	 // namespace core
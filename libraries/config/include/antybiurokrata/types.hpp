@@ -12,6 +12,7 @@
 // Project includes
 #include <antybiurokrata/libraries/logger/logger.h>
 #include <antybiurokrata/libraries/patterns/seiralizer.hpp>
+#include <antybiurokrata/transcoder.hpp>
 
 // STL
 #include <memory>
@@ -74,25 +75,6 @@ namespace core
 	struct u16str_serial;
 	struct u16str_deserial;
 
-	/**
-	 * @brief returns the conversion engine object
-	 * 
-	 * @return std::wstring_convert
-	 */
-	inline auto get_conversion_engine()
-	{
-		/** 
-		 * @brief standard library abomination, to bypass deleter 
-		 * @link https://en.cppreference.com/w/cpp/locale/codecvt#Example
-		*/
-		using codecvt_t = std::codecvt<u16char_t, char_t, std::mbstate_t>;
-		struct deletable_codecvt : public codecvt_t
-		{
-			~deletable_codecvt() {}
-		};
-		return std::wstring_convert<deletable_codecvt, u16char_t>{"Error", u"Error"};
-	}
-
 	/**
 	 * @brief contains basic defninitions and tools for throwing exceptions
 	 */
@@ -112,14 +94,14 @@ namespace core
 			exception() = default;
 
 			template<typename Any> exception(const Any& msg) : _what{msg} {}
-			exception(const u16str& msg) { _what = get_conversion_engine().to_bytes(msg); }
+			exception(const u16str& msg) : _what{transcoding::to_utf8(msg)} {}
 			exception(const u16str_v& msg) : exception{u16str{msg.data(), msg.size()}} {}
 			exception(const str& msg) : _what{msg} {}
 			exception(const str_v& msg) : _what{msg} {}
 
 			virtual const char* what() const noexcept override { return _what.data(); }
 			str_v what_v() const noexcept { return this->_what; }
-			u16str w_what() const { return get_conversion_engine().from_bytes(this->_what); }
+			u16str w_what() const { return transcoding::to_utf16(this->_what); }
 			// const MsgType& what() const noexcept { return this->_what; }
 
 			// virtual const str& what() const noexcept { return this->___what; }
@@ -323,7 +305,7 @@ namespace core
 			 * @param ex any exception
 			 */
 			explicit error_report(const exception<u16str>& ex) :
-				 error_report{core::get_conversion_engine().to_bytes(ex.w_what())}
+				 error_report{transcoding::to_utf8(ex.w_what())}
 			{
 			}
 
@@ -0,0 +1,206 @@
+#include <antybiurokrata/transcoder.hpp>
+
+// STL
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace core
+{
+	namespace transcoding
+	{
+		namespace
+		{
+			/** @brief amount of code units processed at once in ASCII fast path */
+			constexpr size_t lanes = 16ul;
+
+#if defined(__GNUC__) || defined(__clang__)
+			using u8x16_t	= uint8_t __attribute__((vector_size(lanes)));
+			using u16x16_t = uint16_t __attribute__((vector_size(lanes * sizeof(uint16_t))));
+
+			/** @brief checks is any lane of comparison result set */
+			template<typename mask_t> inline bool any(const mask_t& mask) noexcept
+			{
+				using words_t		 = std::array<uint64_t, sizeof(mask_t) / sizeof(uint64_t)>;
+				const auto words = std::bit_cast<words_t>(mask);
+				uint64_t result{0ul};
+				for(const uint64_t w: words) result |= w;
+				return result != 0ul;
+			}
+#endif
+
+			/**
+			 * @brief copies leading ASCII run, widening or narrowing every code unit
+			 *
+			 * @return size_t amount of copied code units, this is only fast path, so tail can be left
+			 */
+			template<typename in_t, typename out_t>
+			inline size_t copy_ascii(const in_t* input, const size_t size, out_t* output) noexcept
+			{
+				size_t i = 0;
+#if defined(__GNUC__) || defined(__clang__)
+				using in_vector_t	 = std::conditional_t<sizeof(in_t) == 1ul, u8x16_t, u16x16_t>;
+				using out_vector_t = std::conditional_t<sizeof(out_t) == 1ul, u8x16_t, u16x16_t>;
+				for(; i + lanes <= size; i += lanes)
+				{
+					in_vector_t v;
+					std::memcpy(&v, input + i, sizeof(v));
+					const auto non_ascii = v > 0x7F;
+					if(any(non_ascii)) break;
+
+					const out_vector_t converted = __builtin_convertvector(v, out_vector_t);
+					std::memcpy(output + i, &converted, sizeof(converted));
+				}
+#endif
+				for(; i < size && static_cast<uint16_t>(input[i]) < 0x80; ++i)
+					output[i] = static_cast<out_t>(input[i]);
+				return i;
+			}
+
+			constexpr bool is_continuation(const unsigned char c) noexcept
+			{
+				return (c & 0xC0) == 0x80;
+			}
+		}	 // namespace
+
+		std::optional<size_t> utf8_to_utf16(const std::string_view input, char16_t* output) noexcept
+		{
+			const size_t size = input.size();
+			const auto byte	= [&](const size_t i) { return static_cast<unsigned char>(input[i]); };
+
+			size_t i = 0;
+			size_t o = 0;
+			while(i < size)
+			{
+				const size_t ascii = copy_ascii(input.data() + i, size - i, output + o);
+				i += ascii;
+				o += ascii;
+				if(i == size) break;
+
+				// continuation byte, lead of overlong 2-byte sequence or of code point above U+10FFFF
+				const unsigned char lead = byte(i);
+				if(lead < 0xC2 || lead > 0xF4) return std::nullopt;
+
+				size_t length;
+				char32_t code_point;
+				char32_t minimum;
+				if((lead & 0xE0) == 0xC0)
+				{
+					length	  = 2ul;
+					code_point = lead & 0x1F;
+					minimum	  = 0x80;
+				}
+				else if((lead & 0xF0) == 0xE0)
+				{
+					length	  = 3ul;
+					code_point = lead & 0x0F;
+					minimum	  = 0x800;
+				}
+				else
+				{
+					length	  = 4ul;
+					code_point = lead & 0x07;
+					minimum	  = 0x10000;
+				}
+
+				// truncated last character is dropped, whatever it contains
+				if(size - i < length) return o;
+				for(size_t k = 1; k < length; ++k)
+				{
+					if(!is_continuation(byte(i + k))) return std::nullopt;
+					code_point = (code_point << 6) | (byte(i + k) & 0x3F);
+				}
+				i += length;
+
+				// overlong encodings and values out of unicode range are invalid
+				if(code_point < minimum || code_point > 0x10FFFF) return std::nullopt;
+
+				if(code_point < 0x10000) output[o++] = static_cast<char16_t>(code_point);
+				else
+				{
+					code_point -= 0x10000;
+					output[o++] = static_cast<char16_t>(0xD800 + (code_point >> 10));
+					output[o++] = static_cast<char16_t>(0xDC00 + (code_point & 0x3FF));
+				}
+			}
+			return o;
+		}
+
+		std::optional<size_t> utf16_to_utf8(const std::u16string_view input, char* output) noexcept
+		{
+			const size_t size = input.size();
+
+			size_t i = 0;
+			size_t o = 0;
+			while(i < size)
+			{
+				const size_t ascii = copy_ascii(input.data() + i, size - i, output + o);
+				i += ascii;
+				o += ascii;
+				if(i == size) break;
+
+				char32_t code_point = input[i++];
+				if(code_point >= 0xDC00 && code_point <= 0xDFFF) return std::nullopt;
+				if(code_point >= 0xD800 && code_point <= 0xDBFF)
+				{
+					if(i == size) return o;	 // truncated last character is dropped
+					if(input[i] < 0xDC00 || input[i] > 0xDFFF) return std::nullopt;
+					code_point = 0x10000 + ((code_point - 0xD800) << 10) + (input[i++] - 0xDC00);
+				}
+
+				if(code_point < 0x800)
+				{
+					output[o++] = static_cast<char>(0xC0 | (code_point >> 6));
+					output[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+				}
+				else if(code_point < 0x10000)
+				{
+					output[o++] = static_cast<char>(0xE0 | (code_point >> 12));
+					output[o++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					output[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+				}
+				else
+				{
+					output[o++] = static_cast<char>(0xF0 | (code_point >> 18));
+					output[o++] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+					output[o++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+					output[o++] = static_cast<char>(0x80 | (code_point & 0x3F));
+				}
+			}
+			return o;
+		}
+
+		bool append_utf16(const std::string_view input, std::u16string& output)
+		{
+			const size_t offset = output.size();
+			output.resize(offset + max_utf16_length(input.size()));
+			const std::optional<size_t> written = utf8_to_utf16(input, output.data() + offset);
+			output.resize(offset + written.value_or(0ul));
+			return written.has_value();
+		}
+
+		bool append_utf8(const std::u16string_view input, std::string& output)
+		{
+			const size_t offset = output.size();
+			output.resize(offset + max_utf8_length(input.size()));
+			const std::optional<size_t> written = utf16_to_utf8(input, output.data() + offset);
+			output.resize(offset + written.value_or(0ul));
+			return written.has_value();
+		}
+
+		std::u16string to_utf16(const std::string_view input)
+		{
+			std::u16string result;
+			if(!append_utf16(input, result)) return std::u16string{error_utf16};
+			return result;
+		}
+
+		std::string to_utf8(const std::u16string_view input)
+		{
+			std::string result;
+			if(!append_utf8(input, result)) return std::string{error_utf8};
+			return result;
+		}
+	}	 // namespace transcoding
+}	 // namespace core
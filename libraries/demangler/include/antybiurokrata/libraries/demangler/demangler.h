@@ -13,12 +13,13 @@
 
 #include <antybiurokrata/libraries/logger/logger.h>
 #include <antybiurokrata/types.hpp>
+#include <antybiurokrata/character_tables.hpp>
 #include <codecvt>
 #include <locale>
 #include <string>
 #include <tuple>
 #include <regex>
-#include <map>
+#include <array>
 
 namespace core
 {
@@ -34,47 +35,41 @@ namespace core
 			URL  = 2 /**  @brief this will replace polish letters to unicode in UTF-8 transformation */
 		};
 
-		/** @brief type used in internal map in letter_converter as key */
+		/** @brief type used in translation tables as key */
 		using translation_key_t = u16char_t;
 
-		/** @brief type used in internal map in letter_converter as value */
+		/** @brief type used in translation tables as value, views are on string literals */
 		struct translation_value_t
 		{
-			const u16char_t eng;
-			const u16str html;
-			const u16str url;
-
-			translation_value_t(const u16char_t c, const u16str& s, const u16str& u) :
-				 eng{c}, html{s}, url{u} {};
+			u16char_t eng;
+			u16str_v html;
+			u16str_v url;
 
 			/** @brief optimalized accessor */
-			template<conversion_t type> auto get() const
+			template<conversion_t type> constexpr auto get() const
 			{
 				if constexpr(conversion_t::ENG == type) return eng;
 				else if constexpr(conversion_t::HTML == type)
-					return u16str_v{html};
+					return html;
 				else if constexpr(conversion_t::URL == type)
-					return u16str_v{url};
-
-				core::dassert{false, "invalid decision path"_u8};
-				return decltype(get<type>()){};
+					return url;
 			}
 		};
 
-		/**
-		 * @brief provides polish translation
-		*/
-		struct depolonizator : Log<depolonizator>
+		/** @brief single entry of translation table */
+		struct translation_entry_t
 		{
-			using translation_map_t = std::map<translation_key_t, translation_value_t>;
-			using kv_type				= std::pair<const translation_key_t, translation_value_t>;
-			using iterator_t			= decltype(((translation_map_t*)(nullptr))->cbegin());
+			translation_key_t key;
+			translation_value_t value;
+		};
 
+		namespace translation_tables
+		{
 			/** @brief source of encies http://taat.pl/en/narzedzia/utf-8/#tab18 */
-			inline static const translation_map_t translation{std::initializer_list<kv_type>{
+			constexpr std::array<translation_entry_t, 21> translation{{
 
 				 // polish chars
-				 kv_type{u'ą', translation_value_t{u'a', u"&#0261", u"%C4%85"}},
+				 {u'ą', {u'a', u"&#0261", u"%C4%85"}},
 				 {u'ć', {u'c', u"&#0263", u"%C4%87"}},
 				 {u'ę', {u'e', u"&#0281", u"%C4%99"}},
 				 {u'ł', {u'l', u"&#0322", u"%C5%82"}},
@@ -98,22 +93,128 @@ namespace core
 				 {u' ', {u' ', u"&#0032", u"+"}},
 				 {u'-', {u'-', u"&#0045", u"-"}}}};
 
-			static std::tuple<bool, iterator_t> safe_get(translation_key_t letter)
+			/** @brief marks empty slot in lookup tables */
+			constexpr uint8_t empty_slot = 0xFF;
+
+			/** @brief all keys are lower than this, so forward table can be indexed directly by letter */
+			constexpr translation_key_t forward_limit = 0x0180;
+
+			/** @brief index in `translation` for every letter lower than `forward_limit` */
+			constexpr std::array<uint8_t, forward_limit> forward = [] {
+				std::array<uint8_t, forward_limit> result{};
+				result.fill(empty_slot);
+				for(uint8_t i = 0; i < translation.size(); ++i)
+				{
+					if(translation[i].key >= forward_limit) throw "key out of forward table range";
+					result[translation[i].key] = i;
+				}
+				return result;
+			}();
+
+			/** @brief FNV-1a, with seed used as offset basis */
+			constexpr uint32_t hash(const u16str_v tag, const uint32_t seed) noexcept
+			{
+				uint32_t result = seed;
+				for(const u16char_t c: tag)
+				{
+					result ^= c;
+					result *= 16'777'619u;
+				}
+				return result;
+			}
+
+			/** @brief perfect hash table from tags of one type to indexes in `translation` */
+			struct reverse_table_t
 			{
-				const iterator_t found = translation.find(letter);
-				return {found != translation.end(), found};
+				static constexpr size_t size = 64ul;
+
+				uint32_t seed;
+				std::array<uint8_t, size> slots;
+
+				/** @brief slot for given tag */
+				constexpr uint8_t& at(const u16str_v tag) { return slots[hash(tag, seed) % size]; }
+				constexpr uint8_t at(const u16str_v tag) const { return slots[hash(tag, seed) % size]; }
+			};
+
+			/**
+			 * @brief looks for seed, for which all tags of given type land in separate slots
+			 *
+			 * @tparam type HTML or URL
+			 * @return reverse_table_t
+			 */
+			template<conversion_t type> constexpr reverse_table_t make_reverse_table()
+			{
+				for(uint32_t seed = 2'166'136'261u;; ++seed)
+				{
+					reverse_table_t result{seed, {}};
+					result.slots.fill(empty_slot);
+
+					bool collision = false;
+					for(uint8_t i = 0; i < translation.size() && !collision; ++i)
+					{
+						uint8_t& slot = result.at(translation[i].value.get<type>());
+						collision	  = slot != empty_slot;
+						slot			  = i;
+					}
+					if(!collision) return result;
+				}
+			}
+
+			template<conversion_t type> constexpr reverse_table_t reverse = make_reverse_table<type>();
+		}	 // namespace translation_tables
+
+		/**
+		 * @brief counts leading code units, that demangle copies without changes
+		 *
+		 * @param view input
+		 * @param stop_on_specials if true, `_`, ` ` and `-` also ends run (they are translated in HTML and URL)
+		 * @return size_t length of leading ASCII run
+		 */
+		size_t ascii_run(const u16str_v view, const bool stop_on_specials) noexcept;
+
+		/**
+		 * @brief sanitizes leading ASCII run: appends uppercased letters and digits, drops rest
+		 *
+		 * @param view input
+		 * @param out output
+		 * @return size_t amount of consumed code units, stops at first non-ASCII code unit
+		 */
+		size_t sanitize_ascii(const u16str_v view, u16str& out);
+
+		/**
+		 * @brief provides polish translation
+		*/
+		struct depolonizator : Log<depolonizator>
+		{
+			/**
+			 * @brief looks up translation of given letter
+			 *
+			 * @param letter letter to translate
+			 * @return const translation_value_t* translation or nullptr, if there is no translation
+			 */
+			static constexpr const translation_value_t* find(const translation_key_t letter) noexcept
+			{
+				using namespace translation_tables;
+				if(letter >= forward_limit || forward[letter] == empty_slot) return nullptr;
+				return &translation[forward[letter]].value;
 			}
 
 			/** @brief optimalized accessor */
-			template<conversion_t type> static str_v get(translation_key_t letter)
+			template<conversion_t type> static auto get(const translation_key_t letter)
 			{
-				return translation.at(letter).get<type>();
+				const translation_value_t* value = find(letter);
+				dassert(value != nullptr, "there is no translation for given letter"_u8);
+				return value->get<type>();
 			}
 
-			template<conversion_t type> static char16_t reverse_get(const u16str_v& tag)
+			template<conversion_t type>
+			requires(type == conversion_t::HTML || type == conversion_t::URL) static char16_t
+				 reverse_get(const u16str_v& tag)
 			{
-				for(const auto& kv: translation)
-					if(kv.second.get<type>() == tag) return kv.first;
+				using namespace translation_tables;
+				const uint8_t index = reverse<type>.at(tag);
+				if(index != empty_slot && translation[index].value.get<type>() == tag)
+					return translation[index].key;
 				get_logger().warn() << "tag `" << tag << "` not found" << logger::endl;
 				return u'\0';
 			}
@@ -207,10 +308,9 @@ namespace core
 		 */
 		template<conv_t type> static void mangle(str& out)
 		{
-			auto conv = core::get_conversion_engine();
-			u16str tmp{conv.from_bytes(out)};
+			u16str tmp{transcoding::to_utf16(out)};
 			mangle<type>(tmp);
-			out = std::move(conv.to_bytes(tmp));
+			out = transcoding::to_utf8(tmp);
 		}
 
 		/**
@@ -271,12 +371,15 @@ namespace core
 			demangler<u16str, u16str_v> dmg{out};
 			u16str_v preprocessed = dmg.process<conv_t::ENG>().get();
 
-			const std::locale loc{plPL()};
-			for(const u16char_t c: preprocessed)
-				if(std::isalnum<wchar_t>(
-						 static_cast<wchar_t>(c),
-						 loc) /* || u' ' == c */)	 // possiblility of problem with diffrence in double space
-					ret += static_cast<u16char_t>(std::toupper<wchar_t>(static_cast<wchar_t>(c), loc));
+			// characters, that are still not ASCII after demangling, are classified with static tables
+			for(size_t pos = detail::sanitize_ascii(preprocessed, ret); pos < preprocessed.size();
+				 pos += detail::sanitize_ascii(preprocessed.substr(pos), ret))
+			{
+				const u16char_t c = preprocessed[pos++];
+				if(characters::is_alnum(
+						 c) /* || u' ' == c */)	 // possiblility of problem with diffrence in double space
+					ret += characters::to_upper(c);
+			}
 
 			out = std::move(ret);
 		}
@@ -291,31 +394,33 @@ namespace core
 		{
 			if(out.size() == 0) return;
 
+			// if it's ENG, just check if it's in ASCII range, otherwise exclude ' _-' chars
+			constexpr bool stop_on_specials = conv_t::ENG != type;
+
+			// in polish language most of letters are in <0;127> ASCII range, so usually there is nothing to do
+			const u16str_v view{out};
+			size_t pos = detail::ascii_run(view, stop_on_specials);
+			if(pos == view.size()) [[likely]]
+				return;
+
 			u16str wout{};
 
 			if constexpr(conv_t::HTML == type) wout.reserve(4 * out.size());
 			else
 				wout.reserve(out.size());
 
-			// for(const u16char_t c: out)
-			for(auto it = out.begin(); it != out.end(); ++it)
+			wout.append(view.substr(0, pos));
+			while(pos < view.size())
 			{
-				const u16char_t c = *it;
-				if(
-					 // if it's ENG, just check if it's in ASCII range, otherwise exclude ' _-' chars
-					 c <= std::numeric_limits<char_t>::max()
-					 && (conv_t::ENG == type or (u'_' != c and u' ' != c and u'-' != c)))
-					 [[likely]]	  // in polish language most of letters are in <0;255> ASCII range
-				{
-					wout += c;
-				}
+				const u16char_t c = view[pos++];
+				const detail::translation_value_t* found = detail::depolonizator::find(c);
+				if(found) wout += found->get<type>();
 				else
-				{
-					const auto [found, it] = detail::depolonizator::safe_get(c);
-					if(found) wout += it->second.get<type>();
-					else
-						wout += c;
-				}
+					wout += c;
+
+				const size_t run = detail::ascii_run(view.substr(pos), stop_on_specials);
+				wout.append(view.substr(pos, run));
+				pos += run;
 			}
 
 			wout.shrink_to_fit();
@@ -330,10 +435,9 @@ namespace core
 		 */
 		template<conv_t type> static void demangle(str& out)
 		{
-			auto conv = core::get_conversion_engine();
-			u16str tmp{conv.from_bytes(out)};
+			u16str tmp{transcoding::to_utf16(out)};
 			demangle<type>(tmp);
-			out = std::move(conv.to_bytes(tmp));
+			out = transcoding::to_utf8(tmp);
 		}
 	};
 }	 // namespace core
@@ -13,8 +13,22 @@
 
 #include <antybiurokrata/types.hpp>
 
+// STL
+#include <span>
+
 namespace core
 {
+	/**
+	 * @brief extracts words from html (removing tags) in one pass over UTF-8 bytes; kept
+	 * characters are moved in place to the front of buffer, so words are views into it
+	 * 
+	 * @remark words are valid as long as buffer is not modified or destroyed
+	 * 
+	 * @param html UTF-8 encoded html, content is overwritten
+	 * @param output [out] words, appended in order of occurrence
+	 */
+	void html_scalpel(std::span<char> html, std::vector<str_v>& output);
+
 	/**
 	 * @brief this function can be used to extract words from html (removing tags)
 	 * 
@@ -1,5 +1,111 @@
 #include <antybiurokrata/libraries/demangler/demangler.h>
 
+// STL
+#include <bit>
+#include <cstring>
+
+// on x86-64 GCC and Clang generate AVX2 and baseline versions, selected at load time
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ANTYBIUROKRATA_SIMD_DISPATCH __attribute__((target_clones("avx2", "default")))
+#else
+#define ANTYBIUROKRATA_SIMD_DISPATCH
+#endif
+
+namespace core
+{
+	namespace detail
+	{
+		namespace
+		{
+			/** @brief amount of code units processed at once */
+			constexpr size_t lanes = 16ul;
+
+#if defined(__GNUC__) || defined(__clang__)
+			using u16x16_t = uint16_t __attribute__((vector_size(lanes * sizeof(uint16_t))));
+			using mask_t	= int16_t __attribute__((vector_size(lanes * sizeof(uint16_t))));
+
+			/** @brief loads `lanes` code units, without alignment requirements */
+			inline void load(u16x16_t& out, const u16char_t* data) noexcept
+			{
+				std::memcpy(&out, data, sizeof(out));
+			}
+
+			/** @brief checks is any lane of mask set */
+			inline bool any(const mask_t& mask) noexcept
+			{
+				using words_t		 = std::array<uint64_t, sizeof(mask_t) / sizeof(uint64_t)>;
+				const auto words = std::bit_cast<words_t>(mask);
+				uint64_t result{0ul};
+				for(const uint64_t w: words) result |= w;
+				return result != 0ul;
+			}
+#endif
+
+			/** @brief ASCII letters and digits */
+			constexpr bool is_ascii_alnum(const u16char_t c) noexcept
+			{
+				return (c >= u'0' && c <= u'9') || (c >= u'A' && c <= u'Z') || (c >= u'a' && c <= u'z');
+			}
+
+			/** @brief ASCII uppercase */
+			constexpr u16char_t ascii_upper(const u16char_t c) noexcept
+			{
+				return (c >= u'a' && c <= u'z') ? c - (u'a' - u'A') : c;
+			}
+
+			/** @brief scalar version of single step of `ascii_run` */
+			constexpr bool is_plain(const u16char_t c, const bool stop_on_specials) noexcept
+			{
+				return c <= std::numeric_limits<char_t>::max()
+						 && !(stop_on_specials && (u'_' == c || u' ' == c || u'-' == c));
+			}
+		}	 // namespace
+
+		ANTYBIUROKRATA_SIMD_DISPATCH size_t ascii_run(const u16str_v view,
+																	 const bool stop_on_specials) noexcept
+		{
+			size_t i = 0;
+#if defined(__GNUC__) || defined(__clang__)
+			for(; i + lanes <= view.size(); i += lanes)
+			{
+				u16x16_t v;
+				load(v, view.data() + i);
+				mask_t stop		  = v > std::numeric_limits<char_t>::max();
+				if(stop_on_specials) stop |= (v == u'_') | (v == u' ') | (v == u'-');
+				if(any(stop)) break;	  // exact position is found by scalar loop
+			}
+#endif
+			for(; i < view.size(); ++i)
+				if(!is_plain(view[i], stop_on_specials)) break;
+			return i;
+		}
+
+		ANTYBIUROKRATA_SIMD_DISPATCH size_t sanitize_ascii(const u16str_v view, u16str& out)
+		{
+			size_t i = 0;
+#if defined(__GNUC__) || defined(__clang__)
+			for(; i + lanes <= view.size(); i += lanes)
+			{
+				u16x16_t v;
+				load(v, view.data() + i);
+				const mask_t non_ascii = v > std::numeric_limits<char_t>::max();
+				if(any(non_ascii)) break;
+
+				const mask_t lower = (v >= u'a') & (v <= u'z');
+				const u16x16_t upper = v - (reinterpret_cast<const u16x16_t&>(lower) & (u'a' - u'A'));
+				const mask_t keep
+					 = ((upper >= u'0') & (upper <= u'9')) | ((upper >= u'A') & (upper <= u'Z'));
+				for(size_t lane = 0; lane < lanes; ++lane)
+					if(keep[lane]) out += static_cast<u16char_t>(upper[lane]);
+			}
+#endif
+			for(; i < view.size() && view[i] <= std::numeric_limits<char_t>::max(); ++i)
+				if(is_ascii_alnum(view[i])) out += ascii_upper(view[i]);
+			return i;
+		}
+	}	 // namespace detail
+}	 // namespace core
+
 template<> void core::demangler<>::mangle_html(core::u16str& out)
 {
 	static const auto valid_html_tag = [](const u16str_v& view) -> bool {
@@ -1,59 +1,102 @@
 #include <antybiurokrata/libraries/html_scalpel/html_scalpel.h>
+#include <antybiurokrata/character_tables.hpp>
+
+// STL
+#include <array>
+#include <cstring>
 
 namespace core
 {
-	void html_scalpel(const str_v& input_html, std::vector<u16str>& output)
+	namespace
 	{
+		/** @brief marks invalid UTF-8 sequences, such characters are dropped */
+		constexpr char32_t invalid_code_point{0xFFFFFFFF};
+
+		/** @brief ascii characters, that are kept in words: letters, digits and `-_ \t&#+/.,` */
+		constexpr std::array<bool, 128> ascii_accepted = [] {
+			std::array<bool, 128> result{};
+			for(char c = 'a'; c <= 'z'; ++c) result[c] = true;
+			for(char c = 'A'; c <= 'Z'; ++c) result[c] = true;
+			for(char c = '0'; c <= '9'; ++c) result[c] = true;
+			for(const char c: str_v{"-_ \t&#+/.,"}) result[c] = true;
+			return result;
+		}();
+
+		/** @brief same as `std::isalpha || std::isdigit || accepted` in polish locale */
+		constexpr bool is_correct(const char32_t c) noexcept
+		{
+			return c < ascii_accepted.size() ? ascii_accepted[c] : characters::is_alpha(c);
+		}
+
+		/**
+		 * @brief decodes one UTF-8 character
+		 *
+		 * @param bytes input
+		 * @param pos [in, out] position of character, moved to the next one
+		 * @return char32_t code point or `invalid_code_point`
+		 */
+		char32_t next_code_point(const std::span<char> bytes, size_t& pos) noexcept
+		{
+			const auto byte = [&](const size_t i) { return static_cast<unsigned char>(bytes[i]); };
+			const unsigned char lead = byte(pos++);
+			if(lead < 0x80) return lead;
+
+			// amount of continuation bytes
+			size_t length{0ul};
+			if((lead & 0xE0) == 0xC0) length = 1ul;
+			else if((lead & 0xF0) == 0xE0)
+				length = 2ul;
+			else if((lead & 0xF8) == 0xF0)
+				length = 3ul;
+			else
+				return invalid_code_point;
 
-		// first convert to u16
-		constexpr size_t word_prereserve_size{20ul};
-		auto converter = get_conversion_engine();
-		const u16str wide_html{converter.from_bytes(input_html.data())};
+			char32_t result = lead & (0x3F >> length);
 
-		// conversion to wchar_t is required, because std does not suppert u16 for isaplha and isdigit :(
-		const auto is_correct = [](const wchar_t c) -> bool {
-			constexpr std::wstring_view accepted{L"-_ \t&#+/.,"};
-			return std::isalpha(c, plPL()) || std::isdigit(c, plPL())
-					 || accepted.find(c) != std::wstring_view::npos;
-		};
+			for(size_t i = 0; i < length; ++i)
+			{
+				if(pos == bytes.size() || (byte(pos) & 0xC0) != 0x80) return invalid_code_point;
+				result = (result << 6) | (byte(pos++) & 0x3F);
+			}
+			return result;
+		}
+	}	 // namespace
 
-		// prereserve, to improve performance
-		output.reserve(500);
+	void html_scalpel(std::span<char> html, std::vector<str_v>& output)
+	{
+		char* const buffer = html.data();
+		size_t read			 = 0ul;
+		size_t write		 = 0ul;
+		size_t word			 = 0ul;
 
-		// initialize required varriables
-		u16str word;
-		word.reserve(word_prereserve_size);
 		bool in_tag				 = false;
-		bool in_quote			 = false;
 		bool ignore_next		 = false;
 		bool is_double_spaced = false;
 
-		for(const u16char_t c: wide_html)
+		while(read < html.size())
 		{
+			const size_t start = read;
+			const char32_t c	 = next_code_point(html, read);
+
 			if(ignore_next) ignore_next = false;
-			else if(u'\\' == c)
+			else if(U'\\' == c)
 				ignore_next = true;
-			else if(in_tag && (u'"' == c || u'\'' == c))
-				in_quote = !in_quote;
-			else if(!in_tag && u'<' == c)
+			else if(!in_tag && U'<' == c)
 				in_tag = true;
-			else if(in_tag && u'>' == c)
+			else if(in_tag && U'>' == c)
 			{
 				in_tag = false;
 				if(!is_double_spaced)
 				{
-					// output += ' ';
-					word.shrink_to_fit();
-					output.emplace_back(std::move(word));
-					word.clear();
-					word.reserve(word_prereserve_size);
+					output.emplace_back(buffer + word, write - word);
+					word				  = write;
 					is_double_spaced = true;
 				}
 			}
 			else if(!in_tag && is_correct(c))
 			{
-				if(is_double_spaced && u'.' == c) continue;
-				if(u' ' == c || u'\t' == c)
+				if(is_double_spaced && U'.' == c) continue;
+				if(U' ' == c || U'\t' == c)
 				{
 					if(is_double_spaced) continue;
 					else
@@ -62,13 +105,22 @@ namespace core
 				else
 					is_double_spaced = false;
 
-				if(u',' == c) is_double_spaced = true;
+				if(U',' == c) is_double_spaced = true;
 
-				word += c;
+				// kept characters never overtake read position, so words already emitted stay intact
+				if(write != start) std::memmove(buffer + write, buffer + start, read - start);
+				write += read - start;
 			}
 		}
+	}
+
+	void html_scalpel(const str_v& input_html, std::vector<u16str>& output)
+	{
+		str buffer{input_html};
+		std::vector<str_v> words;
+		html_scalpel(buffer, words);
 
-		// reduce size to reuired minimum to optimalize memory usage
-		output.shrink_to_fit();
+		output.reserve(output.size() + words.size());
+		for(const str_v word: words) output.emplace_back(transcoding::to_utf16(word));
 	}
-}	 // namespace core
\ No newline at end of file
+}	 // namespace core
@@ -11,6 +11,11 @@
 
 #pragma once
 
+// STL
+#include <condition_variable>
+#include <exception>
+#include <list>
+
 // Project Includes
 #include <antybiurokrata/libraries/summary/summary.h>
 namespace core
@@ -25,25 +30,34 @@ namespace core
 		 */
 		template<objects::match_type mt> struct universal_getter
 		{
-			using delegate_t	= patterns::call_ownership_delegator<size_t>;
+			using delegate_t	= std::function<void(size_t)>;
 			using w_summary_t = std::shared_ptr<reports::summary>;
+			using page_t
+				 = typename std::remove_cvref_t<decltype(network::global_adapters::get<mt>())>::value_t;
+			using page_function_t = std::function<void(page_t&)>;
+			using download_t		 = std::function<void(const str&, const page_function_t&)>;
 
-			delegate_t& on_progress;
+			delegate_t on_progress;
 			w_summary_t sum;
+			download_t download;
 			std::shared_ptr<orm::persons_extractor_t> prsn_visitor;
 			std::shared_ptr<orm::publications_extractor_t> pub_visitor;
 
+			/** @brief error of getter, rethrown by owner after join, as getter runs in separate thread */
+			std::exception_ptr error{nullptr};
+
 			/**
 			 * @brief Construct a new universal getter object
 			 * 
 			 * @param source source of 
 			 * @param i_sum object to use as summary engine
 			 * @param i_on_progress function to call on progress
+			 * @param i_download downloads pages of publications for given orcid
 			 */
 			universal_getter(const objects::shared_person_t& source, w_summary_t i_sum,
-								  delegate_t& i_on_progress) :
+								  delegate_t i_on_progress, download_t i_download) :
 				 on_progress{i_on_progress},
-				 sum{i_sum}, prsn_visitor{new orm::persons_extractor_t{}}
+				 sum{i_sum}, download{i_download}, prsn_visitor{new orm::persons_extractor_t{}}
 			{
 				// copy just one person
 				objects::shared_person_t current{};
@@ -55,32 +69,95 @@ namespace core
 				pub_visitor.reset(new orm::publications_extractor_t{*prsn_visitor});
 			}
 
-			void operator()(std::mutex& mtx, std::condition_variable_any& cv)
+			/**
+			 * @brief proxy to get, but stores exception in `error` instead of throwing it
+			 * 
+			 * @param stop_token stops waiting for summary
+			 */
+			void operator()(const std::stop_token& stop_token) noexcept
 			{
-				core::check_nullptr{prsn_visitor};
-
-				// gather data from given data source
-				const auto result = network::global_adapters::get<mt>().get_person(
-					 objects::detail::detail_orcid_t::to_string(
-						  (*(*this->prsn_visitor->persons->begin())())().orcid()()));
-
-				// process input data
-				for(auto& x: *result)
+				try
+				{
+					get(stop_token);
+				}
+				catch(...)
 				{
-					x.accept(&(*pub_visitor));
-					on_progress(1);
+					error = std::current_exception();
 				}
+			}
 
-				// wait for summary to be generated
-				if(!sum && sum->ready())
+			/**
+			 * @brief downloads data in streaming mode and matches every page as soon as it's parsed
+			 * 
+			 * @param stop_token stops waiting for summary
+			 * 
+			 * @exception any exception of data source or summary, after all downloaded pages are processed
+			 */
+			void get(const std::stop_token& stop_token)
+			{
+				core::check_nullptr{prsn_visitor};
+
+				std::mutex mtx_pages;
+				std::condition_variable_any cv_pages;
+				std::list<page_t> pages;
+				bool finished = false;
+				std::exception_ptr producer_error{nullptr};
+
+				// gather data from given data source, in separate thread, so network and matching overlaps
+				std::jthread producer{[&]() {
+					try
+					{
+						download(objects::detail::detail_orcid_t::to_string(
+										(*(*this->prsn_visitor->persons->begin())())().orcid()()),
+									[&](page_t& page) {
+										{
+											std::unique_lock<std::mutex> lk{mtx_pages};
+											pages.emplace_back(std::move(page));
+										}
+										cv_pages.notify_one();
+									});
+					}
+					catch(...)
+					{
+						producer_error = std::current_exception();
+					}
+
+					{
+						std::unique_lock<std::mutex> lk{mtx_pages};
+						finished = true;
+					}
+					cv_pages.notify_one();
+				}};
+
+				check_nullptr{sum};
+
+				// process input data, page by page
+				while(true)
 				{
-					std::unique_lock<std::mutex> lk{mtx};
-					cv.wait(lk);	// wait just once
-					check_nullptr{sum};
+					page_t page{};
+					{
+						std::unique_lock<std::mutex> lk{mtx_pages};
+						cv_pages.wait(lk, [&] { return finished || !pages.empty(); });
+						if(pages.empty()) break;
+						page = std::move(pages.front());
+						pages.pop_front();
+					}
+
+					const size_t processed = pub_visitor->publications.size();
+					for(auto& x: page)
+					{
+						x.accept(&(*pub_visitor));
+						on_progress(1);
+					}
+
+					// generate report for new publications, copied from const references, as copy of
+					// non-const shared object creates new, empty one
+					const std::vector<objects::shared_publication_t> batch(
+						 pub_visitor->publications.cbegin() + processed, pub_visitor->publications.cend());
+					sum->process(batch, mt, stop_token);
 				}
 
-				// generate report
-				sum->process(pub_visitor->publications, mt);
+				if(producer_error) std::rethrow_exception(producer_error);
 			}
 		};
 	}	 // namespace detail
@@ -96,6 +173,18 @@ namespace core
 	 */
 	class engine : public Log<engine>
 	{
+	 public:
+		/** @brief identifies author in batch mode, if orcid is empty, name and surname are used */
+		struct author_t
+		{
+			str orcid{};
+			str name{};
+			str surname{};
+		};
+
+		/** @brief by default so many authors are processed at once in batch mode */
+		constexpr static size_t default_batch_concurrency = 4ul;
+
 	 protected:
 		using Log<engine>::log;
 		template<typename T> using container = std::shared_ptr<T>;
@@ -108,11 +197,27 @@ namespace core
 		using error_summary_t						 = container<core::exceptions::error_report>;
 		using stop_token_t							 = std::stop_token;
 		using worker_function_t						 = std::function<void(const stop_token_t&, bool&)>;
+		using progress_function_t					 = std::function<void(size_t)>;
+		using persons_function_t					 = std::function<void(const persons_summary_t&)>;
+
+	 public:
+		/** @brief output of processing one author in batch mode */
+		struct author_summary_t
+		{
+			author_t author;
+			summary_t summary;
+			persons_summary_t persons;
+		};
+		using shared_author_summary_t = container<author_summary_t>;
+
+	 protected:
 
 		struct process_functor_t;
 		struct process_name_and_surname_functor_t;
+		struct process_batch_functor_t;
 		friend struct process_functor_t;
 		friend struct process_name_and_surname_functor_t;
+		friend struct process_batch_functor_t;
 
 		/**
 		 * @brief functor that is used to call `process` in separate thread
@@ -153,6 +258,25 @@ namespace core
 			}
 		};
 
+		/**
+		 * @brief functor that is used to call `process_batch` in separate thread
+		 */
+		struct process_batch_functor_t
+		{
+			engine* that;
+			std::vector<author_t> authors;
+			size_t concurrency;
+
+			void operator()(const stop_token_t& token, bool& ready)
+			{
+				that->process_batch(token, authors, concurrency);
+				ready = true;
+			}
+		};
+
+		/** @brief workers of summaries, shared between all processed authors */
+		std::shared_ptr<patterns::thread_pool> m_pool{new patterns::thread_pool{}};
+
 		/** @brief storage for last summary (cache a bit) */
 		summary_t m_last_summary;
 
@@ -171,6 +295,9 @@ namespace core
 		/** @brief only default cnstructible */
 		engine();
 
+		/** @brief stops and joins worker, before observables are destroyed */
+		virtual ~engine();
+
 		/** @brief sends how many items will be processed */
 		observable<size_t> on_calculated_progress;
 		/** @brief sends current progess */
@@ -183,6 +310,8 @@ namespace core
 		observable<persons_summary_t> on_collaboration_finish;
 		/** @brief sends with error summary, when something goes wrong */
 		observable<error_summary_t> on_error;
+		/** @brief in batch mode, sends summary of every author, `on_finish` gets merged report of all authors */
+		observable<shared_author_summary_t> on_author_finish;
 
 		/** @brief returns last summary, if avaiable */
 		const summary_t& get_last_summary() const;
@@ -215,6 +344,21 @@ namespace core
 		 */
 		void start(const str& name, const str& surname);
 
+		/**
+		 * @brief produces summaries for many authors at once (ex. whole department)
+		 * 
+		 * @param authors authors to process, duplicates are processed once
+		 * @param concurrency maximal amount of authors processed at the same time
+		 * 
+		 * @remark this function automatically detaches to new thread
+		 * @remark progress is counted in processed authors
+		 * @remark if processing is stopped, authors in progress are reported with `on_error` and
+		 * `on_finish` gets report merged from authors finished before stop
+		 * @exception assert_exception if worker is already running
+		 */
+		void start(const std::vector<author_t>& authors,
+					  const size_t concurrency = default_batch_concurrency);
+
 	 protected:
 		/**
 		 * @brief gets name and surname object with given orcid
@@ -256,6 +400,63 @@ namespace core
 		void process_impl(const stop_token_t&, const str& name, const str& surname,
 								const str& orcid = str{});
 
+		/**
+		 * @brief processes authors with bounded amount of threads, errors of single author are reported with `on_error`
+		 * 
+		 * @remark all delegates are called under one lock, so slots are never called concurrently;
+		 * `on_finish` is sent also when stopped, with report of authors finished before stop
+		 * 
+		 * @param authors authors to process
+		 * @param concurrency maximal amount of authors processed at the same time
+		 */
+		void process_batch(const stop_token_t&, const std::vector<author_t>& authors,
+								 const size_t concurrency) noexcept;
+
+		/** @brief records of bg.polsl.pl, passed one by one as soon as they are parsed */
+		using record_function_t = network::detail::bgpolsl_stream_parser_t::record_callback_t;
+
+		/** @brief page of records from alternative data source (SCOPUS or ORCID) */
+		using page_function_t = std::function<void(std::list<network::detail::json_repr_t>&)>;
+
+		/**
+		 * @brief downloads reference publications from bg.polsl.pl
+		 * 
+		 * @param name valid name
+		 * @param surname valid surname
+		 * @param on_record called with every parsed record
+		 * 
+		 * @exception any exception of data source
+		 */
+		virtual void download_reference(const str& name, const str& surname,
+												  const record_function_t& on_record);
+
+		/**
+		 * @brief downloads publications of person from alternative data source
+		 * 
+		 * @param mt data source, SCOPUS or ORCID
+		 * @param orcid valid orcid string
+		 * @param on_page called with every parsed page
+		 * 
+		 * @exception any exception of data source
+		 */
+		virtual void download_publications(const objects::match_type mt, const str& orcid,
+													  const page_function_t& on_page);
+
+		/**
+		 * @brief gathers data from all sources and compares them
+		 * 
+		 * @param name valid name
+		 * @param surname valid surname
+		 * @param orcid [optional] valid orcid
+		 * @param on_step_progress called with amount of processed items, if set
+		 * @param on_persons called with collaborators, as soon as they are known, if set
+		 * @return summary_t report of one author
+		 * 
+		 * @exception assert_exception if checks fails
+		 */
+		summary_t collect(const stop_token_t&, const str& name, const str& surname, const str& orcid,
+								progress_function_t on_step_progress, persons_function_t on_persons);
+
 		/** @brief if cannot create new thread throws assert_exception */
 		void check_is_new_worker_possible() const;
 
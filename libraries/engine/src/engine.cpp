@@ -1,6 +1,7 @@
 #include <antybiurokrata/libraries/engine/engine.h>
 #include <antybiurokrata/libraries/global_adapters.hpp>
 
+#include <algorithm>
 #include <condition_variable>
 #include <shared_mutex>
 
@@ -13,6 +14,8 @@ engine::engine()
 	on_collaboration_finish.register_slot([&proxy](engine::persons_summary_t ptr) { proxy = ptr; });
 }
 
+engine::~engine() { m_worker.reset(); }
+
 void engine::get_name_and_surname(const str& orcid, str& out_name, str& out_surname) const
 {
 	try
@@ -78,6 +81,24 @@ void engine::start(const str& name, const str& surname)
 }
 
 
+void engine::start(const std::vector<author_t>& authors, const size_t concurrency)
+{
+	dassert{concurrency > 0ul, "at least one author has to be processed at once"_u8};
+
+	// skip duplicates, but keep order
+	std::vector<author_t> unique_authors;
+	unique_authors.reserve(authors.size());
+	for(const author_t& author: authors)
+		if(std::find_if(unique_authors.begin(), unique_authors.end(), [&](const author_t& other) {
+				return author.orcid == other.orcid && author.name == other.name
+						 && author.surname == other.surname;
+			}) == unique_authors.end())
+			unique_authors.push_back(author);
+
+	setup_new_thread(process_batch_functor_t{this, std::move(unique_authors), concurrency});
+}
+
+
 engine::error_summary_t engine::prepare_error_summary() const
 {
 	return std::make_shared<core::exceptions::error_report>(
@@ -160,11 +181,131 @@ void engine::process_name_and_surname(const std::stop_token& stop_token, const s
 
 void engine::process_impl(const std::stop_token& stop_token, const str& name, const str& surname,
 								  const str& orcid)
+{
+	auto on_progress_delegate				  = on_progress.delegate_ownership();
+	auto on_collaboration_finish_delegate = on_collaboration_finish.delegate_ownership();
+
+	const summary_t result = collect(
+		 stop_token,
+		 name,
+		 surname,
+		 orcid,
+		 [&](const size_t x) { on_progress_delegate(x); },
+		 [&](const persons_summary_t& persons) { on_collaboration_finish_delegate(persons); });
+
+	check_nullptr{result};
+	m_last_summary = result;
+	on_finish(result);
+	on_progress(100);
+}
+
+void engine::process_batch(const std::stop_token& stop_token, const std::vector<author_t>& authors,
+									const size_t concurrency) noexcept
+{
+	on_start();
+	on_calculated_progress(authors.size());
+
+	auto on_progress_delegate		= on_progress.delegate_ownership();
+	auto on_error_delegate			= on_error.delegate_ownership();
+	auto on_author_finish_delegate = on_author_finish.delegate_ownership();
+
+	std::mutex mtx;
+	std::atomic<size_t> next{0ul};
+	std::vector<summary_t> summaries(authors.size());
+
+	// every author is processed with same function, as in single mode, but progress is counted in authors
+	const auto process_author = [&](const author_t& author) -> summary_t {
+		str name{author.name}, surname{author.surname};
+		if(!author.orcid.empty())
+		{
+			dassert(core::objects::orcid_t::value_t::is_valid_orcid_string(author.orcid),
+					  "given string is not valid orcid!"_u8);
+			if(name.empty() || surname.empty()) get_name_and_surname(author.orcid, name, surname);
+		}
+
+		shared_author_summary_t result{
+			 new author_summary_t{author, summary_t{}, persons_summary_t{}}};
+		result->summary = collect(
+			 stop_token,
+			 name,
+			 surname,
+			 author.orcid,
+			 progress_function_t{},
+			 [&](const persons_summary_t& persons) { result->persons = persons; });
+		check_nullptr{result->summary};
+
+		std::unique_lock<std::mutex> lck{mtx};
+		on_author_finish_delegate(result);
+		return result->summary;
+	};
+
+	const auto worker = [&]() {
+		for(size_t i = next++; i < authors.size() && !stop_token.stop_requested(); i = next++)
+		{
+			error_summary_t error{};
+			try
+			{
+				summaries[i] = process_author(authors[i]);
+			}
+			catch(const core::exceptions::exception<str>& e)
+			{
+				error = prepare_error_summary(e);
+			}
+			catch(const core::exceptions::exception<u16str>& e)
+			{
+				error = prepare_error_summary(e);
+			}
+			catch(const std::exception& e)
+			{
+				error = prepare_error_summary(e);
+			}
+			catch(...)
+			{
+				error = prepare_error_summary();
+			}
+
+			std::unique_lock<std::mutex> lck{mtx};
+			if(error) on_error_delegate(error);
+			on_progress_delegate(1);
+		}
+	};
+
+	{
+		std::vector<std::jthread> workers;
+		const size_t count = std::min(concurrency, authors.size());
+		for(size_t i = 0; i < count; ++i) workers.emplace_back(worker);
+	}
+
+	// when stopped, summaries of not finished authors are nullptr and are skipped
+	const summary_t result = reports::merge_reports(summaries);
+	m_last_summary			  = result;
+	on_finish(result);
+}
+
+void engine::download_reference(const str& name, const str& surname,
+										  const record_function_t& on_record)
+{
+	ga::polsl.get_person(name, surname, on_record);
+}
+
+void engine::download_publications(const objects::match_type mt, const str& orcid,
+											  const page_function_t& on_page)
+{
+	if(mt == objects::match_type::SCOPUS) ga::scopus.get_person(orcid, on_page);
+	else if(mt == objects::match_type::ORCID)
+		ga::orcid.get_person(orcid, on_page);
+	else
+		dassert(false, "only SCOPUS and ORCID are alternative data sources!"_u8);
+}
+
+engine::summary_t engine::collect(const std::stop_token& stop_token, const str& name,
+											 const str& surname, const str& orcid,
+											 progress_function_t on_step_progress,
+											 persons_function_t on_persons)
 {
 	// standarize incoming data
-	auto conv = get_conversion_engine();
-	const objects::polish_name_t w_name{conv.from_bytes(name)};
-	const objects::polish_name_t w_surname{conv.from_bytes(surname)};
+	const objects::polish_name_t w_name{transcoding::to_utf16(name)};
+	const objects::polish_name_t w_surname{transcoding::to_utf16(surname)};
 	str w_orcid{orcid};
 	objects::shared_person_t person{};
 	if(!w_orcid.empty())
@@ -176,19 +317,20 @@ void engine::process_impl(const std::stop_token& stop_token, const str& name, co
 	else
 		person().data().reset();
 
+	const bool verbose = static_cast<bool>(on_step_progress);
+	if(!on_step_progress) on_step_progress = [](size_t) {};
+
 
 	// setup workers
 	orm::persons_extractor_t scopus_visitor{};
 	orm::persons_extractor_t inner_persons_extractor{};
 	orm::publications_extractor_t inner_publications_extractor{inner_persons_extractor};
-	std::shared_ptr<reports::summary> sum{new reports::summary{}};
+	summary_t result{};	 // declared before summary, because it's set when summary is destroyed
+	std::shared_ptr<reports::summary> sum{new reports::summary{m_pool}};
 
 	// prepare delegates
-	auto on_start_delegate					  = on_start.delegate_ownership();
-	auto on_progress_delegate				  = on_progress.delegate_ownership();
-	auto on_calculated_progress_delegate  = on_calculated_progress.delegate_ownership();
-	auto on_finish_delegate					  = on_finish.delegate_ownership();
-	auto on_collaboration_finish_delegate = on_collaboration_finish.delegate_ownership();
+	auto on_start_delegate					 = on_start.delegate_ownership();
+	auto on_calculated_progress_delegate = on_calculated_progress.delegate_ownership();
 
 	// stop token activation function
 	const auto stop = [&]() {
@@ -198,42 +340,41 @@ void engine::process_impl(const std::stop_token& stop_token, const str& name, co
 	{
 
 		std::mutex mtx_orcid;
-		std::mutex mtx_report;
 		std::condition_variable_any cv_orcid;
-		std::condition_variable_any cv_report;
+
+		// set by bgpolsl thread, rethrown after join, so person waiting can be stopped
+		std::exception_ptr bgpolsl_error{nullptr};
+		std::exception_ptr getters_error{nullptr};
+		bool bgpolsl_finished = false;
 
 		/// @todo maybe put it in another function?
-		const auto bgpolsl_getter = [&]() {
+		const auto bgpolsl_getter_impl = [&]() {
 			// notify, that processing started
-			on_start_delegate();
+			if(verbose) on_start_delegate();
 
-			// gather initial data
-			auto publications_raw = ga::polsl.get_person(name, surname);
+			// gather initial data, persons are extracted as soon as records are parsed
+			size_t records = 0ul;
+			download_reference(name, surname, [&](network::detail::bgpolsl_repr_t&& pub_raw) {
+				pub_raw.accept(&inner_publications_extractor);
+				on_step_progress(1);
+				++records;
+			});
 
-			// inform about total size of incoming data
-			on_calculated_progress_delegate(
-				 publications_raw->size()
-				 * (objects::detail::match_type_translation_unit::length
-					 - 2 /* = ( `NO_MATCH` + `POLSL` (which is reference) ) */));
+			// inform about total size of incoming data, known after last record
+			if(verbose)
+				on_calculated_progress_delegate(
+					 records
+					 * (objects::detail::match_type_translation_unit::length
+						 - 2 /* = ( `NO_MATCH` + `POLSL` (which is reference) ) */));
 
-			// extract persons
-			for(auto& pub_raw: *publications_raw)
-			{
-				pub_raw.accept(&inner_publications_extractor);
-				on_progress_delegate(1);
-			}
-			on_collaboration_finish_delegate(inner_persons_extractor.persons);
+			if(on_persons) on_persons(inner_persons_extractor.persons);
 
 			// setup summary engine
-			auto& last_summary = this->m_last_summary;
 			sum->activate(inner_publications_extractor.publications);
 			sum->on_done.register_slot([&](core::reports::report_t ptr) {
 				check_nullptr{ptr};
-				last_summary = ptr;
-				on_finish_delegate(ptr);
-				on_progress_delegate(100);
+				result = ptr;
 			});
-			cv_report.notify_all();
 
 			// if orcid is already given return
 			if(person()) return;
@@ -242,7 +383,10 @@ void engine::process_impl(const std::stop_token& stop_token, const str& name, co
 				const auto& in_p = (*p());
 				if(in_p().name == w_name && in_p().surname == w_surname)
 				{
-					person = p;
+					{
+						std::unique_lock<std::mutex> lk{mtx_orcid};
+						person = p;
+					}
 					cv_orcid.notify_all();
 				}
 			}
@@ -250,40 +394,75 @@ void engine::process_impl(const std::stop_token& stop_token, const str& name, co
 			check_nullptr{person().data()};
 		};
 
+		// exception cannot leave thread, so it's passed to caller
+		const auto bgpolsl_getter = [&]() {
+			try
+			{
+				bgpolsl_getter_impl();
+			}
+			catch(...)
+			{
+				bgpolsl_error = std::current_exception();
+
+				// without reference data getters cannot match anything, so they cannot wait for it
+				sum->abort();
+			}
+
+			{
+				std::unique_lock<std::mutex> lk{mtx_orcid};
+				bgpolsl_finished = true;
+			}
+			cv_orcid.notify_all();
+		};
+
 		// thread order
 		{
 			stop();
 			std::jthread th1{bgpolsl_getter};
 			stop();
 
-			if(!person())
 			{
 				std::unique_lock<std::mutex> lk{mtx_orcid};
-				cv_orcid.wait(lk, [&] {
-					stop();
-					return person();
-				});
-				dassert(person(), "person is not properly setted up!"_u8);
+				cv_orcid.wait(lk, stop_token, [&] { return person() || bgpolsl_finished; });
 			}
-
 			stop();
-			std::jthread th2{
-				 core::detail::universal_getter<objects::match_type::SCOPUS>{person,
-																								 sum,
-																								 on_progress_delegate},
 
-				 std::ref(mtx_report),
-				 std::ref(cv_report)};
-			stop();
+			// without person there is nothing to look for in other sources, error is rethrown below
+			if(person())
+			{
+				// getters download through engine, so data sources can be replaced
+				const auto download = [this](const objects::match_type mt) {
+					return [this, mt](const str& id, const page_function_t& on_page) {
+						download_publications(mt, id, on_page);
+					};
+				};
+
+				// getters are passed by reference, so their errors are avaiable after join
+				core::detail::universal_getter<objects::match_type::SCOPUS> scopus_getter{
+					 person, sum, on_step_progress, download(objects::match_type::SCOPUS)};
+				core::detail::universal_getter<objects::match_type::ORCID> orcid_getter{
+					 person, sum, on_step_progress, download(objects::match_type::ORCID)};
 
-			std::jthread th3{
-				 core::detail::universal_getter<objects::match_type::ORCID>{person,
-																								sum,
-																								on_progress_delegate},
+				{
+					stop();
+					std::jthread th2{std::ref(scopus_getter), std::cref(stop_token)};
+					stop();
 
-				 std::ref(mtx_report),
-				 std::ref(cv_report)};
-			stop();
+					std::jthread th3{std::ref(orcid_getter), std::cref(stop_token)};
+					stop();
+				}
+
+				getters_error = scopus_getter.error ? scopus_getter.error : orcid_getter.error;
+			}
 		}
+
+		// all threads are joined here
+		if(bgpolsl_error) std::rethrow_exception(bgpolsl_error);
+		if(getters_error) std::rethrow_exception(getters_error);
+		dassert(person(), "person is not properly setted up!"_u8);
 	}
-}
+
+	// last owner of summary triggers `on_done`
+	sum.reset();
+	return result;
+}
\ No newline at end of file
@@ -57,6 +57,31 @@ namespace core
 			void operator()() { process(); }
 
 		 private:
+			/**
+			 * @brief structure of arrays with everything that is printed for report items, filled in
+			 * one pass, so writing rows does not follow pointers to publications and maps of ids
+			 */
+			struct rows_t
+			{
+				constexpr static size_t id_types = objects::detail::id_type_translation_unit::length;
+
+				/** @brief raw, interned ids indexed by `id_type`, nullptr if id is missing */
+				using ids_t = std::array<const u16str*, id_types>;
+
+				std::vector<const u16str*> titles;
+				std::vector<const u16str*> polish_titles;
+				std::vector<uint16_t> years;
+				std::vector<ids_t> ids;
+
+				/** @brief bit `1 << match_type` is set for every source, that matched report item */
+				using match_mask_t
+					 = objects::detail::detail_sourced_publication_storage_t::inner_t::mask_t;
+				std::vector<match_mask_t> matched;
+
+				/** @brief fills columns with given report, ids of matched publications override reference ones */
+				void build(const reports::report_collection_t& report);
+			};
+
 			/** @brief implementation of class functionality */
 			void process_impl();
 		};
@@ -2,6 +2,8 @@
 #include <xlsx/xlsxdocument.h>
 #include <xlsx/xlsxworkbook.h>
 
+#include <bit>
+
 namespace core
 {
 	namespace reports
@@ -25,6 +27,45 @@ namespace core
 		}
 
 
+		void generator::rows_t::build(const reports::report_collection_t& report)
+		{
+			titles.clear();
+			polish_titles.clear();
+			years.clear();
+			ids.clear();
+			matched.clear();
+
+			titles.reserve(report.size());
+			polish_titles.reserve(report.size());
+			years.reserve(report.size());
+			ids.reserve(report.size());
+			matched.reserve(report.size());
+
+			const auto fill_ids = [](const auto& pub, ids_t& output) {
+				for(const auto& id_pair: pub.ids()().data())
+					output[static_cast<size_t>(id_pair.first)] = id_pair.second().raw.handle();
+			};
+
+			for(const auto& value: report)
+			{
+				const auto& ref = (*(*value())().reference()())();
+
+				titles.push_back(ref.title()().raw.handle());
+				const bool has_polish_title = !ref.polish_title()()->empty();
+				polish_titles.push_back(has_polish_title ? ref.polish_title()().raw.handle() : nullptr);
+				years.push_back(ref.year());
+
+				ids_t& row_ids = ids.emplace_back();
+				row_ids.fill(nullptr);
+				fill_ids(ref, row_ids);
+
+				const auto& matches = (*value())().matched()().data();
+				matched.push_back(matches.mask());
+				for(const auto& match: matches) fill_ids((*match.second())(), row_ids);
+			}
+		}
+
+
 		void generator::process_impl()
 		{
 			check_nullptr{m_data};
@@ -103,50 +144,41 @@ namespace core
 			doc.write(first_row, headers.size() + 1, "", black_cell);
 
 
-			for(const auto& value: *m_data)
+			rows_t rows;
+			rows.build(*m_data);
+
+			for(size_t i = 0; i < rows.titles.size(); ++i)
 			{
 				// begin loop
 				++row;
 				col = first_col;
 				on_progress(1);
 
-
-				// aliases
-				const auto& ref	  = (*(*value())().reference()())();
-				const auto& matched = (*value())().matched()().data();
-
 				// reference title
-				doc.write(row, col++, QString::fromStdU16String(ref.title()().raw));
+				doc.write(row, col++, QString::fromStdU16String(*rows.titles[i]));
 
 				// alternative title
-				if(!ref.polish_title()()->empty())
-					doc.write(row, col, QString::fromStdU16String(ref.polish_title()().raw));
+				if(rows.polish_titles[i])
+					doc.write(row, col, QString::fromStdU16String(*rows.polish_titles[i]));
 				col++;
 
 				// year
-				doc.write(row, col++, ref.year());
+				doc.write(row, col++, rows.years[i]);
 
-				// ids
-				for(const auto& id_pair: ref.ids()().data())
-					doc.write(row,
-								 ids_to_col[static_cast<id_type_unit::base_enum_t>(id_pair.first)],
-								 QString::fromStdU16String(id_pair.second().raw));
+				// ids, from reference and matched publications
+				for(size_t type = 0; type < rows_t::id_types; ++type)
+					if(rows.ids[i][type])
+						doc.write(row, ids_to_col[static_cast<id_type_unit::base_enum_t>(type)],
+									 QString::fromStdU16String(*rows.ids[i][type]));
 
 				// matched
-				for(const auto& match: matched)
-				{
-					doc.write(row,
-								 match_to_col[static_cast<match_type_unit::base_enum_t>(
-									  match().source()().data())],
-								 true);
-					for(const auto& id_pair: (*match().publication()().data())().ids()().data())
-						doc.write(row,
-									 ids_to_col[static_cast<id_type_unit::base_enum_t>(id_pair.first)],
-									 QString::fromStdU16String(id_pair.second().raw));
-				}
-
-				if(matched.size() == 0) doc.setRowFormat(row, no_match_format);
-				else if(matched.size() == match_length - 1)
+				const rows_t::match_mask_t mask = rows.matched[i];
+				for(match_type_unit::base_enum_t mt = 0; mt < match_type_unit::length; ++mt)
+					if(mask & (rows_t::match_mask_t{1} << mt)) doc.write(row, match_to_col[mt], true);
+
+				const size_t matched_count = static_cast<size_t>(std::popcount(mask));
+				if(matched_count == 0) doc.setRowFormat(row, no_match_format);
+				else if(matched_count == match_length - 1)
 					doc.setRowFormat(row, full_match_format);
 				else
 					doc.setRowFormat(row, half_match_format);
@@ -14,6 +14,9 @@
 #include <antybiurokrata/libraries/network/network.h>
 #include <antybiurokrata/libraries/patterns/visitor.hpp>
 
+// STL
+#include <functional>
+
 namespace core
 {
 	namespace network
@@ -42,9 +45,64 @@ namespace core
 				*/
 				explicit bgpolsl_repr_t(const std::vector<u16str>& words);
 
+				/**
+				 * @brief Construct a new bgpolsl repr t object, only saved parts are converted to u16str
+				 * 
+				 * @param words UTF-8 words from `html_scalpel`
+				*/
+				explicit bgpolsl_repr_t(const std::vector<str_v>& words);
+
 				/** @brief DEBUG */
 				void print() const;
 			};
+
+			/**
+			 * @brief push parser of bg.polsl.pl response, body is consumed in chunks of any size and
+			 * every record is emitted as soon as its line is complete, so only current line is buffered
+			 */
+			class bgpolsl_stream_parser_t
+			{
+			 public:
+				using record_callback_t = std::function<void(bgpolsl_repr_t&&)>;
+
+				/**
+				 * @brief Construct a new bgpolsl stream parser t object
+				 * 
+				 * @param on_record called for every parsed record
+				 */
+				explicit bgpolsl_stream_parser_t(record_callback_t on_record) :
+					 m_on_record{std::move(on_record)}
+				{
+					dassert{static_cast<bool>(m_on_record), "callback for records is required"_u8};
+				}
+
+				/**
+				 * @brief consumes next part of body
+				 * 
+				 * @param chunk part of body, may end in the middle of line or UTF-8 character
+				 */
+				void feed(str_v chunk);
+
+				/** @brief consumes last, not terminated line, call it after last chunk */
+				void finish();
+
+			 private:
+				record_callback_t m_on_record;
+
+				/** @brief not terminated line from previous chunks */
+				str m_line{};
+
+				/** @brief buffers reused between records, words are views into `m_buffer` */
+				str m_buffer{};
+				std::vector<str_v> m_words{};
+
+				/**
+				 * @brief emits record if line contains one
+				 * 
+				 * @param line complete line, without `'\n'`
+				 */
+				void consume_line(const str_v& line);
+			};
 		}	 // namespace detail
 
 		/** @brief data collector for bg.polsl.pl */
@@ -54,17 +112,33 @@ namespace core
 			using value_t	= std::list<detail::bgpolsl_repr_t>;
 			using result_t = std::shared_ptr<value_t>;
 
+			/** @brief responses are cached for this time, university database is updated rarely */
+			constexpr static response_cache::duration_t response_ttl{std::chrono::hours{24}};
+
 			/** @brief default constructor */
-			bgpolsl_adapter() : connection_handler{"https://www.bg.polsl.pl", true} {}
+			bgpolsl_adapter() :
+				 connection_handler{"https://www.bg.polsl.pl", true, 1ul, response_ttl}
+			{
+			}
 
 			/**
-				 * @brief get the result from bg.polsl.pl for given name and surname
-				 * 
-				 * @param name of author
-				 * @param surname of author
-				 * @return result_t list of trival object representation
-				 */
-			[[nodiscard]] result_t get_person(const str_v& name, const str_v& surname);
+			 * @brief get the result from bg.polsl.pl for given name and surname, every record is
+			 * passed to callback as soon as it is parsed
+			 * 
+			 * @param name of author
+			 * @param surname of author
+			 * @param on_record called for every record
+			 */
+			void get_person(const str_v& name, const str_v& surname,
+								 const detail::bgpolsl_stream_parser_t::record_callback_t& on_record);
+
+			/**
+			 * @brief extracts publications from response of bg.polsl.pl
+			 * 
+			 * @param body html page returned for query
+			 * @return result_t list of trival object representation
+			 */
+			[[nodiscard]] static result_t parse(const str_v& body);
 
 		 private:
 			/**
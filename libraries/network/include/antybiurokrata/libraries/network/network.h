@@ -12,11 +12,14 @@
 #pragma once
 
 // STL
+#include <atomic>
+#include <future>
 #include <list>
 
 // Project includes
 #include <antybiurokrata/libraries/patterns/visitor.hpp>
 #include <antybiurokrata/libraries/logger/logger.h>
+#include <antybiurokrata/libraries/response_cache/response_cache.h>
 #include <antybiurokrata/types.hpp>
 
 // drogon
@@ -98,7 +101,18 @@ namespace core
 		class connection_handler : public Log<connection_handler>
 		{
 			std::shared_ptr<typename detail::loop_holder_t> loop; /** @brief pointer to loop */
-			drogon::HttpClientPtr connection; /** @brief drogon HTTP connection interface */
+
+			/** @brief drogon HTTP connection interfaces */
+			std::vector<drogon::HttpClientPtr> connections;
+
+			/** @brief round-robin counter */
+			std::atomic<size_t> next_connection{0ul};
+
+			/** @brief maximal age of cached response, 0 disables cache */
+			response_cache::duration_t cache_ttl;
+
+			/** @brief url to host, part of cache keys, so different hosts never share responses */
+			const str host_url;
 
 		 protected:
 			using Log<connection_handler>::log;
@@ -111,16 +125,57 @@ namespace core
 			 * 
 			 * @param url url to host
 			 * @param detached if set to true, connection will have own thread for execution, if false (default) it will use global loop
+			 * @param connections_count amount of parallel connections with host, requests are spread between them
+			 * @param i_cache_ttl responses not older than this are taken from `response_cache::global()`, 0 (default) disables cache
 			 */
-			explicit connection_handler(const str_v& url, const bool detached = false);
+			explicit connection_handler(
+				 const str_v& url, const bool detached = false, const size_t connections_count = 1ul,
+				 const response_cache::duration_t i_cache_ttl = response_cache::duration_t{0});
 			connection_handler() = delete;
 
 			/**
-			 * @brief sends given request and returns raw result
+			 * @brief sends given request and returns raw result, can be called from many threads at once
 			 * 
 			 * @return raw_response_t 
 			 */
 			raw_response_t send_request(raw_request_t);
+
+			/**
+			 * @brief sends given request without blocking, response is set by thread of loop
+			 * 
+			 * @return std::future<raw_response_t> 
+			 */
+			std::future<raw_response_t> send_request_async(raw_request_t);
+
+			/** @brief amount of parallel connections with host */
+			size_t connections_count() const noexcept { return connections.size(); }
+
+		 private:
+			/** @brief picks next connection, so parallel requests go through different clients */
+			const drogon::HttpClientPtr& next();
+
+			/**
+			 * @brief describes request as string: host, method, path, sorted parameters and body
+			 * 
+			 * @return str key for `response_cache`
+			 */
+			str cache_key(const raw_request_t& request) const;
+
+			/**
+			 * @brief looks for response in cache
+			 * 
+			 * @param request request to look for
+			 * @return std::optional<raw_response_t> response built from cached body
+			 */
+			std::optional<raw_response_t> load_from_cache(const raw_request_t& request) const;
+
+			/**
+			 * @brief puts body of successfull response in cache
+			 * 
+			 * @param request sent request
+			 * @param response received response
+			 */
+			void store_in_cache(const raw_request_t& request, const raw_response_t& response) const;
 		};
 	}	 // namespace network
 }	 // namespace core
\ No newline at end of file
@@ -21,11 +21,18 @@ namespace core
 		struct orcid_adapter : protected connection_handler, private Log<orcid_adapter>
 		{
 			using Log<orcid_adapter>::log;
-			using value_t	= std::list<detail::json_repr_t>;
-			using result_t = std::shared_ptr<value_t>;
+			using value_t			 = std::list<detail::json_repr_t>;
+			using result_t			 = std::shared_ptr<value_t>;
+			using page_callback_t = std::function<void(value_t&)>;
+
+			/** @brief amount of records passed at once to callback in streaming mode */
+			constexpr static size_t page_size = 25ul;
+
+			/** @brief responses are cached for this time, authors can update their profiles at any time */
+			constexpr static response_cache::duration_t response_ttl{std::chrono::hours{6}};
 
 			/** @brief default constructor */
-			orcid_adapter() : connection_handler{"https://pub.orcid.org", true} {}
+			orcid_adapter() : connection_handler{"https://pub.orcid.org", true, 1ul, response_ttl} {}
 
 			/**
 			 * @brief get the result from orcid for given orcid string
@@ -35,6 +42,24 @@ namespace core
 			 */
 			[[nodiscard]] result_t get_person(const str& orcid);
 
+			/**
+			 * @brief streaming version of `get_person`, every `page_size` parsed records is passed to callback as soon as it's parsed
+			 * 
+			 * @param orcid string in format that maatches regex: ([0-9]{4})-\1-\1-\1
+			 * @param on_page called with parsed records, can take them over
+			 */
+			void get_person(const str& orcid, const page_callback_t& on_page);
+
+			/**
+			 * @brief parses list of works, that `get_person` downloads
+			 * 
+			 * @param json body of response
+			 * @param orcid string, added to every record
+			 * @param on_page called with every `page_size` parsed records, can take them over
+			 */
+			static void parse_works(const Json::Value& json, const str& orcid,
+											const page_callback_t& on_page);
+
 			/**
 			 * @brief gets name and surname object for given orcid
 			 * 
@@ -0,0 +1,123 @@
+/**
+ * @file response_cache.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains declaration of persistent cache for http responses
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#pragma once
+
+// STL
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+// Project includes
+#include <antybiurokrata/libraries/logger/logger.h>
+#include <antybiurokrata/types.hpp>
+
+namespace core
+{
+	namespace network
+	{
+		/**
+		 * @brief content-addressed cache of response bodies, stored on disk, one file per response
+		 * 
+		 * @remark file name is 128-bit hash of key, whole key is stored in file as well, so collisions are detected
+		 * @remark on hit header and key are checked first, body is read only if they match
+		 * @remark least recently used files are removed, when size limit is exceeded
+		 */
+		class response_cache : public Log<response_cache>
+		{
+			using Log<response_cache>::log;
+
+		 public:
+			using clock_t	  = std::chrono::system_clock;
+			using duration_t = std::chrono::seconds;
+			using hash_t	  = std::array<uint64_t, 2>;
+
+			/** @brief by default cache can take so many bytes on disk */
+			constexpr static size_t default_max_size = 256ul * 1024ul * 1024ul;
+
+			/**
+			 * @brief Construct a new response cache object, and loads informations about already cached files
+			 * 
+			 * @param directory place for cache files, created if not exists, accessible only by owner
+			 * @param max_size limit of all files size in bytes
+			 */
+			explicit response_cache(const std::filesystem::path& directory,
+											const size_t max_size = default_max_size);
+
+			/**
+			 * @brief returns cached body for given key
+			 * 
+			 * @param key describes request (method, path, parameters, body)
+			 * @param ttl maximal age of cached response
+			 * @return std::optional<str> body, if found and not expired
+			 */
+			std::optional<str> get(const str_v& key, const duration_t ttl);
+
+			/**
+			 * @brief stores body for given key, may evict least recently used responses
+			 * 
+			 * @param key describes request (method, path, parameters, body)
+			 * @param body body of response
+			 */
+			void put(const str_v& key, const str_v& body);
+
+			/** @brief sum of sizes of cached files */
+			size_t size() const;
+
+			/**
+			 * @brief cache shared by all connections, stored in `$XDG_CACHE_HOME/antybiurokrata`, or
+			 * in `$HOME/.cache/antybiurokrata` if first variable is not set
+			 */
+			static response_cache& global();
+
+			/** @brief directory of `global` cache, for current user */
+			static std::filesystem::path default_directory();
+
+			/**
+			 * @brief computes 128-bit hash (two 64-bit FNV-1a with different offsets)
+			 * 
+			 * @param key any string
+			 * @return hash_t 
+			 */
+			static hash_t hash(const str_v& key) noexcept;
+
+		 private:
+			/** @brief informations about one cached file */
+			struct entry_t
+			{
+				size_t size;
+				std::filesystem::file_time_type last_access;
+			};
+
+			/** @brief hashes already hashed value */
+			struct hash_hasher_t
+			{
+				size_t operator()(const hash_t& h) const noexcept { return h[0] ^ h[1]; }
+			};
+
+			/** @brief path to file for given hash */
+			std::filesystem::path path_of(const hash_t& h) const;
+
+			/** @brief removes least recently used files, untill size is in limit */
+			void evict();
+
+			/** @brief removes file and entry */
+			void remove(const hash_t& h);
+
+			const std::filesystem::path m_directory;
+			const size_t m_max_size;
+			mutable std::mutex m_mtx;
+			std::unordered_map<hash_t, entry_t, hash_hasher_t> m_entries;
+			size_t m_size{0ul};
+		};
+	}	 // namespace network
+}	 // namespace core
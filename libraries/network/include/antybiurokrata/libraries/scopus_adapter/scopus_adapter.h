@@ -21,11 +21,32 @@ namespace core
 		struct scopus_adapter : protected connection_handler, private Log<scopus_adapter>
 		{
 			using Log<scopus_adapter>::log;
-			using value_t	= std::list<detail::json_repr_t>;
-			using result_t = std::shared_ptr<value_t>;
+			using value_t			 = std::list<detail::json_repr_t>;
+			using result_t			 = std::shared_ptr<value_t>;
+			using page_callback_t = std::function<void(value_t&)>;
+
+			/** @brief amount of connections with host, and default limit of concurrent requests */
+			constexpr static size_t default_max_in_flight = 4ul;
+
+			/** @brief responses are cached for this time, index is updated rarely */
+			constexpr static response_cache::duration_t response_ttl{std::chrono::hours{24}};
 
 			/** @brief default constructor */
-			scopus_adapter() : connection_handler{"https://api.elsevier.com", true} {}
+			scopus_adapter() :
+				 connection_handler{
+					  "https://api.elsevier.com", true, default_max_in_flight, response_ttl}
+			{
+			}
+
+			/**
+			 * @brief sets limit of concurrently downloaded pages
+			 * 
+			 * @param value limit, clamped to [1; default_max_in_flight]
+			 */
+			void max_in_flight(const size_t value);
+
+			/** @brief returns limit of concurrently downloaded pages */
+			size_t max_in_flight() const noexcept { return m_max_in_flight.load(); }
 
 			/**
 			 * @brief get the result from scopus for given orcid string
@@ -35,6 +56,26 @@ namespace core
 			 */
 			[[nodiscard]] result_t get_person(const str& orcid);
 
+			/**
+			 * @brief streaming version of `get_person`, every page of results is passed to callback as soon as it's parsed,
+			 * pages after first one are downloaded concurrently, but passed in order
+			 * 
+			 * @param orcid string in format that maatches regex: ([0-9]{4})-\1-\1-\1
+			 * @param on_page called with parsed records, can take them over
+			 */
+			void get_person(const str& orcid, const page_callback_t& on_page);
+
+			/**
+			 * @brief parses one page of search results
+			 * 
+			 * @param json body of response
+			 * @param orcid string, added to every record
+			 * @param total_results [out] amount of all results for given orcid
+			 * @return value_t records from this page
+			 */
+			static value_t parse_page(const Json::Value& json, const str& orcid,
+											  size_t& total_results);
+
 		 private:
 			/**
 			 * @brief prepares request for given orcid string (headers, paths, etc...)
@@ -46,6 +87,19 @@ namespace core
 			 */
 			drogon::HttpRequestPtr prepare_request(const str& orcid, const size_t offset = 0ul,
 																const size_t count = 25ul);
+
+			/**
+			 * @brief extracts json from response and parses it
+			 * 
+			 * @param response raw response for request from `prepare_request`
+			 * @param orcid string, added to every record
+			 * @param total_results [out] amount of all results for given orcid
+			 * @return value_t records from this page
+			 */
+			value_t parse_page(const raw_response_t& response, const str& orcid,
+									 size_t& total_results);
+
+			std::atomic<size_t> m_max_in_flight{default_max_in_flight};
 		};
 	}	 // namespace network
 }	 // namespace core
\ No newline at end of file
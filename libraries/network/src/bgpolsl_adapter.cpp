@@ -4,6 +4,7 @@
 #include <antybiurokrata/libraries/demangler/demangler.h>
 
 // STL
+#include <array>
 #include <map>
 #include <ranges>
 
@@ -18,6 +19,152 @@ namespace core
 
 		namespace detail
 		{
+			namespace
+			{
+				/**
+				 * @brief every label is followed by one separator, which has to be skipped
+				 * 
+				 * @param word UTF-8 word
+				 * @param pos position just after label
+				 * @return size_t position after separator, or size of word if there is nothing after label
+				 */
+				size_t after_separator(const str_v& word, const size_t pos) noexcept
+				{
+					if(pos >= word.size()) return word.size();
+					const unsigned char lead = static_cast<unsigned char>(word[pos]);
+					const size_t length		 = lead < 0x80				  ? 1ul
+													  : (lead & 0xE0) == 0xC0 ? 2ul
+													  : (lead & 0xF0) == 0xE0 ? 3ul
+																					  : 4ul;
+					return std::min(pos + length, word.size());
+				}
+
+				/** @brief label of field and member, where following words are saved (nullptr if ignored) */
+				struct label_t
+				{
+					str_v text;
+					u16str bgpolsl_repr_t::*member;
+				};
+
+				/** @brief all known labels, ordered the same way as keys in `std::map<str_v, ...>` */
+				constexpr std::array<label_t, 17> labels{{
+					 {"Adres", nullptr},
+					 {"Afiliacja", &bgpolsl_repr_t::affiliation},
+					 {"Autorzy", &bgpolsl_repr_t::authors},
+					 {"Czasopismo", nullptr},
+					 {"DOI", &bgpolsl_repr_t::doi},
+					 {"Dyscypliny", nullptr},
+					 {"IDT", &bgpolsl_repr_t::idt},
+					 {"Impact Factor", nullptr},
+					 {"Pobierz", nullptr},
+					 {"Punktacja", nullptr},
+					 {"Rok", &bgpolsl_repr_t::year},
+					 {"Szczegóły", nullptr},
+					 {"Tytuł całości", &bgpolsl_repr_t::whole_title},
+					 {"Tytuł oryginału", &bgpolsl_repr_t::org_title},
+					 {"Uwaga", nullptr},
+					 {"e-ISSN", &bgpolsl_repr_t::e_issn},
+					 {"p-ISSN", &bgpolsl_repr_t::p_issn}}};
+
+				/**
+				 * @brief Aho-Corasick automaton over bytes of `labels`, built once, with failure links
+				 * resolved into complete transition table, so every byte of word costs one lookup
+				 */
+				class labels_matcher_t
+				{
+					using state_t = uint16_t;
+
+					/** @brief marks states, that do not end any label */
+					static constexpr uint8_t no_label = labels.size();
+
+					std::vector<std::array<state_t, 256>> m_transitions;
+
+					/** @brief lowest index of label, that is suffix of state, or `no_label` */
+					std::vector<uint8_t> m_output;
+
+					labels_matcher_t()
+					{
+						// trie
+						m_transitions.emplace_back().fill(0);
+						m_output.push_back(no_label);
+						for(uint8_t i = 0; i < labels.size(); ++i)
+						{
+							state_t state = 0;
+							for(const unsigned char c: labels[i].text)
+							{
+								if(m_transitions[state][c] == 0)
+								{
+									m_transitions[state][c] = static_cast<state_t>(m_transitions.size());
+									m_transitions.emplace_back().fill(0);
+									m_output.push_back(no_label);
+								}
+								state = m_transitions[state][c];
+							}
+							m_output[state] = std::min(m_output[state], i);
+						}
+
+						// failure links, in BFS order, so failure of every state is already complete
+						std::vector<state_t> failure(m_transitions.size(), 0);
+						std::vector<state_t> queue;
+						for(const state_t next: m_transitions[0])
+							if(next != 0) queue.push_back(next);
+
+						for(size_t i = 0; i < queue.size(); ++i)
+						{
+							const state_t state = queue[i];
+							m_output[state]	  = std::min(m_output[state], m_output[failure[state]]);
+							for(size_t c = 0; c < 256ul; ++c)
+							{
+								const state_t next = m_transitions[state][c];
+								if(next == 0)
+									m_transitions[state][c] = m_transitions[failure[state]][c];
+								else
+								{
+									failure[next] = m_transitions[failure[state]][c];
+									queue.push_back(next);
+								}
+							}
+						}
+					}
+
+				 public:
+					/** @brief shared, lazily built instance */
+					static const labels_matcher_t& get()
+					{
+						static const labels_matcher_t instance{};
+						return instance;
+					}
+
+					/**
+					 * @brief finds label, that would be found first by checking all labels in order,
+					 * with `str_v::find`
+					 *
+					 * @param word UTF-8 word
+					 * @return std::pair<const label_t*, size_t> found label (nullptr if none) and its
+					 * first position in word
+					 */
+					std::pair<const label_t*, size_t> find(const str_v& word) const noexcept
+					{
+						uint8_t best	= no_label;
+						size_t position = str_v::npos;
+						state_t state	= 0;
+						for(size_t i = 0; i < word.size() && best != 0; ++i)
+						{
+							state				  = m_transitions[state][static_cast<unsigned char>(word[i])];
+							const uint8_t found = m_output[state];
+							if(found < best)
+							{
+								best		= found;
+								position = i + 1ul - labels[found].text.size();
+							}
+						}
+
+						if(best == no_label) return {nullptr, str_v::npos};
+						return {&labels[best], position};
+					}
+				};
+			}	 // namespace
+
 			void bgpolsl_repr_t::print() const
 			{
 				log.info() << "idt: " << idt << logger::endl;
@@ -33,49 +180,77 @@ namespace core
 
 			bgpolsl_repr_t::bgpolsl_repr_t(const std::vector<u16str>& words)
 			{
-				const std::map<u16str, u16str*> keywords{{std::pair<u16str, u16str*>{u"IDT", &idt},
-																		{u"Rok", &year},
-																		{u"Autorzy", &authors},
-																		{u"Tytuł oryginału", &org_title},
-																		{u"Tytuł całości", &whole_title},
-																		{u"Czasopismo", nullptr},
-																		{u"Szczegóły", nullptr},
-																		{u"p-ISSN", &p_issn},
-																		{u"DOI", &doi},
-																		{u"Impact Factor", nullptr},
-																		{u"e-ISSN", &e_issn},
-																		{u"Adres", nullptr},
-																		{u"Afiliacja", &affiliation},
-																		{u"Punktacja", nullptr},
-																		{u"Pobierz", nullptr},
-																		{u"Dyscypliny", nullptr},
-																		{u"Uwaga", nullptr}}};
+				std::vector<str> storage;
+				storage.reserve(words.size());
+				for(const u16str& word: words) storage.emplace_back(transcoding::to_utf8(word));
+
+				*this = bgpolsl_repr_t{std::vector<str_v>(storage.begin(), storage.end())};
+			}
+
+			bgpolsl_repr_t::bgpolsl_repr_t(const std::vector<str_v>& words)
+			{
+				const labels_matcher_t& matcher = labels_matcher_t::get();
 
 				u16str* savepoint = nullptr;
-				for(const u16str& word: words)
+				for(const str_v word: words)
 				{
-					u16str save_range;
-					for(const auto& kv: keywords)
+					str_v save_range{word};
+					if(const auto [label, pos] = matcher.find(word); label != nullptr)
 					{
-						const size_t pos = word.find(kv.first);
-						if(pos != u16str::npos) /* if found */
-						{
-							savepoint  = kv.second;
-							save_range = u16str_v{word.c_str() + pos + 1ul + kv.first.size()};
-							break;
-						}
-						else
-							save_range = word;
+						savepoint  = label->member ? &(this->*(label->member)) : nullptr;
+						save_range = word.substr(after_separator(word, pos + label->text.size()));
 					}
 
 					if(savepoint)
 					{
+						u16str wide_range{transcoding::to_utf16(save_range)};
 						if(savepoint->size() > 0) *savepoint += u' ';
-						core::demangler<u16str, u16str_v>::mangle<conv_t::HTML>(save_range);
-						*savepoint += save_range;
+						core::demangler<u16str, u16str_v>::mangle<conv_t::HTML>(wide_range);
+						*savepoint += wide_range;
+					}
+				}
+			}
+
+			void bgpolsl_stream_parser_t::feed(str_v chunk)
+			{
+				while(!chunk.empty())
+				{
+					const size_t end_of_line = chunk.find('\n');
+					if(end_of_line == str_v::npos)
+					{
+						m_line.append(chunk);
+						return;
 					}
+
+					// whole line is in chunk, so it is consumed without copying
+					if(m_line.empty()) consume_line(chunk.substr(0, end_of_line));
+					else
+					{
+						m_line.append(chunk.substr(0, end_of_line));
+						consume_line(m_line);
+						m_line.clear();
+					}
+					chunk.remove_prefix(end_of_line + 1ul);
 				}
 			}
+
+			void bgpolsl_stream_parser_t::finish()
+			{
+				if(!m_line.empty()) consume_line(m_line);
+				m_line.clear();
+			}
+
+			void bgpolsl_stream_parser_t::consume_line(const str_v& line)
+			{
+				constexpr str_v match_expresion{
+					 R"(<span class="field_id"><br/><span class="label" name="label_id">IDT:)"};
+				if(line.find(match_expresion) == str_v::npos) return;
+
+				m_buffer.assign(line);
+				m_words.clear();
+				html_scalpel(m_buffer, m_words);
+				m_on_record(bgpolsl_repr_t{m_words});
+			}
 		}	 // namespace detail
 
 		drogon::HttpRequestPtr core::network::bgpolsl_adapter::prepare_request(
@@ -115,12 +290,10 @@ namespace core
 			return req;
 		}
 
-		bgpolsl_adapter::result_t bgpolsl_adapter::get_person(const str_v& name, const str_v& surname)
+		void bgpolsl_adapter::get_person(
+			 const str_v& name, const str_v& surname,
+			 const detail::bgpolsl_stream_parser_t::record_callback_t& on_record)
 		{
-			constexpr str_v match_expresion{
-				 R"(<span class="field_id"><br/><span class="label" name="label_id">IDT:)"};
-			bgpolsl_adapter::result_t result{new value_t{}};
-
 			str full_name{surname};
 			full_name += ' ';
 			full_name += name;
@@ -132,19 +305,21 @@ namespace core
 			dassert{response.first == drogon::ReqResult::Ok, "expected 200 response code"_u8};
 			log.info() << "successfully got response from `https://www.bg.polsl.pl`" << logger::endl;
 
-			const str_v view{response.second->getBody()};
-			for(str_v line: string_utils::split_words<str_v>{view, '\n'})
-			{
-				if(line.find(match_expresion) != std::string::npos)
-				{
-					str tmp{line};
-					std::vector<u16str> words;
-					html_scalpel(tmp, words);
-					result->emplace_back(words);	 // bgpolsl_repr_t{}
-				}
-			}
+			// body is parsed in place, without copying it whole
+			detail::bgpolsl_stream_parser_t parser{on_record};
+			parser.feed(response.second->getBody());
+			parser.finish();
+		}
 
+		bgpolsl_adapter::result_t bgpolsl_adapter::parse(const str_v& body)
+		{
+			bgpolsl_adapter::result_t result{new value_t{}};
+			detail::bgpolsl_stream_parser_t parser{[&](detail::bgpolsl_repr_t&& record) {
+				result->emplace_back(std::move(record));
+			}};
+			parser.feed(body);
+			parser.finish();
 			return result;
 		}
 	}	 // namespace network
-}	 // namespace core
\ No newline at end of file
+}	 // namespace core
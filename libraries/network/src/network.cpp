@@ -1,5 +1,8 @@
 #include <antybiurokrata/libraries/network/network.h>
 
+// STL
+#include <algorithm>
+
 namespace core
 {
 	namespace network
@@ -9,8 +12,12 @@ namespace core
 			loop_holder_t global_loop{};
 		}
 
-		connection_handler::connection_handler(const str_v& url, const bool detached)
+		connection_handler::connection_handler(const str_v& url, const bool detached,
+															const size_t connections_count,
+															const response_cache::duration_t i_cache_ttl) :
+			 cache_ttl{i_cache_ttl}, host_url{url}
 		{
+			dassert{connections_count > 0ul, "at least one connection is required"_u8};
 			using namespace network::detail;
 			if(detached) loop = std::make_shared<loop_holder_t>();
 			else
@@ -18,16 +25,100 @@ namespace core
 				loop = std::shared_ptr<loop_holder_t>{&global_loop, [](loop_holder_t*) {}};
 			}
 			log.info() << "setting up connection with host: `" << url << "`" << logger::endl;
-			this->connection = drogon::HttpClient::newHttpClient(url.data(), loop->handle.get());
-
-			check_nullptr{this->connection};
+			connections.reserve(connections_count);
+			for(size_t i = 0; i < connections_count; ++i)
+			{
+				connections.emplace_back(
+					 drogon::HttpClient::newHttpClient(url.data(), loop->handle.get()));
+				check_nullptr{connections.back()};
+			}
 		}
 
 		connection_handler::raw_response_t connection_handler::send_request(
 			 connection_handler::raw_request_t request)
 		{
-			check_nullptr{this->connection};
-			return this->connection->sendRequest(request);
+			if(auto cached = load_from_cache(request); cached.has_value()) return *cached;
+			const raw_response_t response = next()->sendRequest(request);
+			store_in_cache(request, response);
+			return response;
+		}
+
+		std::future<connection_handler::raw_response_t> connection_handler::send_request_async(
+			 connection_handler::raw_request_t request)
+		{
+			auto promise = std::make_shared<std::promise<raw_response_t>>();
+			std::future<raw_response_t> future = promise->get_future();
+			if(auto cached = load_from_cache(request); cached.has_value())
+			{
+				promise->set_value(*cached);
+				return future;
+			}
+
+			const auto on_response = [this, promise, request](drogon::ReqResult result,
+																			  const drogon::HttpResponsePtr& resp) {
+				const raw_response_t raw{result, resp};
+				store_in_cache(request, raw);
+				promise->set_value(raw);
+			};
+			next()->sendRequest(request, on_response);
+			return future;
+		}
+
+		const drogon::HttpClientPtr& connection_handler::next()
+		{
+			// every client sends requests one by one, so parallel requests go through different clients
+			const size_t id = next_connection.fetch_add(1ul, std::memory_order_relaxed);
+			const drogon::HttpClientPtr& connection = connections[id % connections.size()];
+			check_nullptr{connection};
+			return connection;
+		}
+
+		str connection_handler::cache_key(const raw_request_t& request) const
+		{
+			std::vector<std::pair<str, str>> parameters{request->getParameters().begin(),
+																	  request->getParameters().end()};
+			std::sort(parameters.begin(), parameters.end());
+
+			str key{host_url};
+			key += ' ';
+			key += std::to_string(static_cast<int>(request->method()));
+			key += ' ';
+			key += request->path();
+			for(const auto& kv: parameters)
+			{
+				key += '&';
+				key += kv.first;
+				key += '=';
+				key += kv.second;
+			}
+			key += '\n';
+			key += request->body();
+			return key;
+		}
+
+		std::optional<connection_handler::raw_response_t> connection_handler::load_from_cache(
+			 const raw_request_t& request) const
+		{
+			if(cache_ttl.count() <= 0) return std::nullopt;
+
+			std::optional<str> body = response_cache::global().get(cache_key(request), cache_ttl);
+			if(!body.has_value()) return std::nullopt;
+
+			log.info() << "serving response from cache for path: `" << request->path() << "`"
+						  << logger::endl;
+			drogon::HttpResponsePtr response = drogon::HttpResponse::newHttpResponse();
+			response->setStatusCode(drogon::k200OK);
+			response->setBody(std::move(*body));
+			return raw_response_t{drogon::ReqResult::Ok, response};
+		}
+
+		void connection_handler::store_in_cache(const raw_request_t& request,
+															 const raw_response_t& response) const
+		{
+			if(cache_ttl.count() <= 0 || response.first != drogon::ReqResult::Ok || !response.second
+				|| response.second->getStatusCode() != 200)
+				return;
+			response_cache::global().put(cache_key(request), response.second->getBody());
 		}
 	}	 // namespace network
 }	 // namespace core
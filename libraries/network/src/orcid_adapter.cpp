@@ -168,19 +168,17 @@ namespace core
 		{
 			result_t result_list{new value_t{}};
 			value_t& list = *result_list;
+			get_person(orcid, [&list](value_t& page) { list.splice(list.end(), page); });
+			return result_list;
+		}
 
+		void orcid_adapter::get_person(const str& orcid, const page_callback_t& on_page)
+		{
 			const connection_handler::raw_response_t response = send_request(prepare_request(orcid));
 			dassert{response.first == drogon::ReqResult::Ok, "expected 200 response code"_u8};
 			log.info() << "successfully got response from `https://pub.orcid.org`" << logger::endl;
 
-			using jvalue = Json::Value;
-			const auto empty_array
-				 = jvalue{Json::ValueType::arrayValue};	// alternative return if array is expected
-			const auto null_value = jvalue{
-				 Json::ValueType::
-					  nullValue};	 // alternative result if anything other that array is expected
-
-			std::shared_ptr<jvalue> json{nullptr};
+			std::shared_ptr<Json::Value> json{nullptr};
 			try
 			{
 				json = response.second->getJsonObject();
@@ -196,13 +194,26 @@ namespace core
 			}
 
 			check_nullptr{json};
+			parse_works(*json, orcid, on_page);
+		}
 
-			const jvalue& array = json->get("group", empty_array);
+		void orcid_adapter::parse_works(const Json::Value& json, const str& orcid,
+												  const page_callback_t& on_page)
+		{
+			value_t list{};
+
+			using jvalue = Json::Value;
+			const auto empty_array
+				 = jvalue{Json::ValueType::arrayValue};	// alternative return if array is expected
+			const auto null_value = jvalue{
+				 Json::ValueType::
+					  nullValue};	 // alternative result if anything other that array is expected
+
+			const jvalue& array = json.get("group", empty_array);
 			dassert(array.isArray(), "it's not array"_u8);
 			log.dbg() << "it's array, with size: " << array.size() << " hooray!" << logger::endl;
 			if(array.size() == 0) log.warn() << "array is empty for orcid: " << orcid << logger::endl;
-			auto cengine				= get_conversion_engine();
-			const u16str wide_orcid = cengine.from_bytes(orcid);
+			const u16str wide_orcid = transcoding::to_utf16(orcid);
 
 			using namespace network::detail;
 			for(const jvalue& x: array)
@@ -222,7 +233,7 @@ namespace core
 						const jvalue& year = pub_date.get("year", null_value);
 						if(year == null_value) continue;
 						else
-							obj.year = cengine.from_bytes(year["value"].asCString());
+							obj.year = transcoding::to_utf16(year["value"].asCString());
 						log.dbg() << "added year" << logger::endl;
 					}
 
@@ -236,7 +247,7 @@ namespace core
 							const jvalue& title = pretitle.get("title", null_value);
 							if(title == null_value) continue;
 							else
-								obj.title = cengine.from_bytes(title["value"].asCString());
+								obj.title = transcoding::to_utf16(title["value"].asCString());
 							if(obj.title.find(double_tittle_separator)) double_title = true;
 							log.dbg() << "added tittle" << logger::endl;
 						}
@@ -245,7 +256,7 @@ namespace core
 						{
 							const jvalue& title = pretitle.get("translated-title", null_value);
 							if(title != null_value)
-								obj.translated_title = cengine.from_bytes(title["value"].asCString());
+								obj.translated_title = transcoding::to_utf16(title["value"].asCString());
 							log.dbg() << "added translated tittle" << logger::endl;
 						}
 						else
@@ -279,7 +290,7 @@ namespace core
 						const jvalue& eid_type = item.get("external-id-type", null_value);
 						if(eid_type == null_value) continue;
 						else
-							to_emplace.first = cengine.from_bytes(eid_type.asCString());
+							to_emplace.first = transcoding::to_utf16(eid_type.asCString());
 
 						const jvalue& eid_normalized = item.get("external-id-normalized", null_value);
 						if(eid_normalized == null_value)
@@ -287,10 +298,10 @@ namespace core
 							const jvalue& eid_wild = item.get("external-id-value", null_value);
 							if(eid_wild == null_value) continue;
 
-							to_emplace.second = cengine.from_bytes(eid_wild.asCString());
+							to_emplace.second = transcoding::to_utf16(eid_wild.asCString());
 						}
 						else
-							to_emplace.second = cengine.from_bytes(eid_normalized["value"].asCString());
+							to_emplace.second = transcoding::to_utf16(eid_normalized["value"].asCString());
 
 						log.dbg() << "added id: ( " << to_emplace.first << " ; " << to_emplace.second
 									 << " )" << logger::endl;
@@ -301,9 +312,16 @@ namespace core
 
 				list.emplace_back(std::move(obj));
 				log.dbg() << "properly added publication" << logger::endl;
+
+				// hand over parsed records, so they can be processed while rest is parsed
+				if(list.size() == page_size)
+				{
+					on_page(list);
+					list.clear();
+				}
 			}
 
-			return result_list;
+			if(!list.empty()) on_page(list);
 		}
 	}	 // namespace network
 }	 // namespace core
\ No newline at end of file
@@ -0,0 +1,236 @@
+#include <antybiurokrata/libraries/response_cache/response_cache.h>
+
+// STL
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+namespace
+{
+	/** @brief layout of beginning of every cache file, key and body follows it */
+	struct file_header_t
+	{
+		constexpr static uint64_t expected_magic = 0x4843414359544e41ul;	 // "ANTYCACH"
+
+		uint64_t magic;
+		uint64_t stored_at;	// seconds since epoch
+		uint64_t key_size;
+		uint64_t body_size;
+	};
+
+	constexpr std::string_view extension{".bin"};
+	constexpr size_t hash_chars = 32ul;
+}	 // namespace
+
+namespace core
+{
+	namespace network
+	{
+		response_cache::response_cache(const std::filesystem::path& directory,
+												 const size_t max_size) :
+			 m_directory{directory}, m_max_size{max_size}
+		{
+			// responses can contain private data, so other users cannot read them
+			std::error_code ec;
+			std::filesystem::create_directories(m_directory, ec);
+			if(!ec)
+				std::filesystem::permissions(m_directory, std::filesystem::perms::owner_all,
+													  std::filesystem::perm_options::replace, ec);
+			if(ec)
+			{
+				log.warn() << "cannot create cache directory: " << m_directory.string() << logger::endl;
+				return;
+			}
+
+			// restore informations about files from previous runs
+			for(const auto& file: std::filesystem::directory_iterator{m_directory, ec})
+			{
+				const str name = file.path().filename().string();
+				if(name.size() != hash_chars + extension.size() || !name.ends_with(extension)) continue;
+
+				hash_t h{};
+				try
+				{
+					h[0] = std::stoull(name.substr(0, hash_chars / 2ul), nullptr, 16);
+					h[1] = std::stoull(name.substr(hash_chars / 2ul, hash_chars / 2ul), nullptr, 16);
+				}
+				catch(...)
+				{
+					continue;
+				}
+
+				const size_t size = file.file_size(ec);
+				if(ec) continue;
+				m_entries[h] = entry_t{size, file.last_write_time(ec)};
+				m_size += size;
+			}
+			log.info() << "loaded " << m_entries.size() << " cached responses (" << m_size << " bytes)"
+						  << logger::endl;
+
+			std::unique_lock<std::mutex> lck{m_mtx};
+			evict();
+		}
+
+		response_cache::hash_t response_cache::hash(const str_v& key) noexcept
+		{
+			constexpr uint64_t prime = 0x100000001b3ul;
+			hash_t result{0xcbf29ce484222325ul, 0x84222325cbf29ce4ul};
+			for(const char c: key)
+				for(uint64_t& h: result) h = (h ^ static_cast<uint8_t>(c)) * prime;
+			return result;
+		}
+
+		std::filesystem::path response_cache::path_of(const hash_t& h) const
+		{
+			char name[hash_chars + 1ul];
+			std::snprintf(name,
+							  sizeof(name),
+							  "%016llx%016llx",
+							  static_cast<unsigned long long>(h[0]),
+							  static_cast<unsigned long long>(h[1]));
+			return m_directory / (str{name} + str{extension});
+		}
+
+		std::optional<str> response_cache::get(const str_v& key, const duration_t ttl)
+		{
+			const hash_t h = hash(key);
+			std::unique_lock<std::mutex> lck{m_mtx};
+
+			auto it = m_entries.find(h);
+			if(it == m_entries.end()) return std::nullopt;
+			const std::filesystem::path path = path_of(h);
+
+			try
+			{
+				std::ifstream in{path, std::ios::binary};
+				in.exceptions(std::ios::failbit | std::ios::badbit);
+
+				file_header_t header{};
+				in.read(reinterpret_cast<char*>(&header), sizeof(header));
+				if(header.magic != file_header_t::expected_magic
+					|| it->second.size != sizeof(header) + header.key_size + header.body_size)
+					throw std::length_error{"corrupted"};
+
+				// same hash, but different request
+				str stored_key(header.key_size, '\0');
+				in.read(stored_key.data(), stored_key.size());
+				if(stored_key != key) return std::nullopt;
+
+				const auto stored_at = clock_t::time_point{duration_t{header.stored_at}};
+				if(clock_t::now() - stored_at > ttl)
+				{
+					remove(h);
+					return std::nullopt;
+				}
+
+				// body is read once, directly to returned string
+				str body(header.body_size, '\0');
+				in.read(body.data(), body.size());
+
+				// remember usage also for next runs
+				std::error_code ec;
+				it->second.last_access = std::filesystem::file_time_type::clock::now();
+				std::filesystem::last_write_time(path, it->second.last_access, ec);
+				return body;
+			}
+			catch(const std::exception& e)
+			{
+				log.warn() << "removing unreadable cache file: " << path.string()
+							  << ", what(): " << e.what() << logger::endl;
+				remove(h);
+				return std::nullopt;
+			}
+		}
+
+		void response_cache::put(const str_v& key, const str_v& body)
+		{
+			const hash_t h							= hash(key);
+			const std::filesystem::path path = path_of(h);
+			std::filesystem::path tmp_path	= path;
+			tmp_path += ".tmp";
+
+			const file_header_t header{
+				 file_header_t::expected_magic,
+				 static_cast<uint64_t>(
+					  std::chrono::duration_cast<duration_t>(clock_t::now().time_since_epoch()).count()),
+				 key.size(),
+				 body.size()};
+
+			std::unique_lock<std::mutex> lck{m_mtx};
+
+			// write to temporary file and swap, so readers never see partial file
+			{
+				std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+				out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				out.write(key.data(), key.size());
+				out.write(body.data(), body.size());
+				if(!out)
+				{
+					log.warn() << "cannot write cache file: " << tmp_path.string() << logger::endl;
+					return;
+				}
+			}
+
+			std::error_code ec;
+			std::filesystem::rename(tmp_path, path, ec);
+			if(ec)
+			{
+				std::filesystem::remove(tmp_path, ec);
+				return;
+			}
+
+			const size_t size = sizeof(header) + key.size() + body.size();
+			auto it				= m_entries.find(h);
+			if(it != m_entries.end()) m_size -= it->second.size;
+			m_entries[h] = entry_t{size, std::filesystem::file_time_type::clock::now()};
+			m_size += size;
+			evict();
+		}
+
+		size_t response_cache::size() const
+		{
+			std::unique_lock<std::mutex> lck{m_mtx};
+			return m_size;
+		}
+
+		void response_cache::evict()
+		{
+			while(m_size > m_max_size && !m_entries.empty())
+			{
+				const auto oldest = std::min_element(
+					 m_entries.begin(), m_entries.end(), [](const auto& lhs, const auto& rhs) {
+						 return lhs.second.last_access < rhs.second.last_access;
+					 });
+				remove(oldest->first);
+			}
+		}
+
+		void response_cache::remove(const hash_t& h)
+		{
+			auto it = m_entries.find(h);
+			if(it == m_entries.end()) return;
+			m_size -= it->second.size;
+			m_entries.erase(it);
+
+			std::error_code ec;
+			std::filesystem::remove(path_of(h), ec);
+		}
+
+		std::filesystem::path response_cache::default_directory()
+		{
+			const char* xdg_cache = std::getenv("XDG_CACHE_HOME");
+			if(xdg_cache != nullptr && *xdg_cache != '\0')
+				return std::filesystem::path{xdg_cache} / "antybiurokrata";
+
+			const char* home = std::getenv("HOME");
+			dassert{home != nullptr && *home != '\0', "neither XDG_CACHE_HOME nor HOME is set"_u8};
+			return std::filesystem::path{home} / ".cache" / "antybiurokrata";
+		}
+
+		response_cache& response_cache::global()
+		{
+			static response_cache instance{default_directory()};
+			return instance;
+		}
+	}	 // namespace network
+}	 // namespace core
@@ -3,6 +3,8 @@
 #include <antybiurokrata/libraries/demangler/demangler.h>
 
 // STL
+#include <algorithm>
+#include <deque>
 #include <map>
 
 namespace core
@@ -38,10 +40,41 @@ namespace core
 		{
 			result_t result_list{new value_t{}};
 			value_t& list = *result_list;
+			get_person(orcid, [&list](value_t& page) { list.splice(list.end(), page); });
+			return result_list;
+		}
 
-			size_t offset{0};
-			size_t count{25};
-			size_t total_results{0};
+		scopus_adapter::value_t scopus_adapter::parse_page(const raw_response_t& response,
+																			const str& orcid, size_t& total_results)
+		{
+			dassert{response.first == drogon::ReqResult::Ok, "expected 200 response code"_u8};
+			log.info() << "successfully got response from `https://api.elsevier.com`" << logger::endl;
+
+			std::shared_ptr<Json::Value> json{nullptr};
+			try
+			{
+				json = response.second->getJsonObject();
+			}
+			catch(const std::exception& e)
+			{
+				log.error() << "cought `std::exception` while gathering json. what(): " << logger::endl
+								<< e.what() << logger::endl;
+				throw;
+			}
+			catch(...)
+			{
+				log.error() << "cought unknown exception while gathering json" << logger::endl;
+				throw;
+			}
+
+			check_nullptr{json};
+			return parse_page(*json, orcid, total_results);
+		}
+
+		scopus_adapter::value_t scopus_adapter::parse_page(const Json::Value& json, const str& orcid,
+																			size_t& total_results)
+		{
+			value_t list{};
 
 			using jvalue = Json::Value;
 			const auto empty_array
@@ -49,92 +82,95 @@ namespace core
 			const auto null_value = jvalue{
 				 Json::ValueType::
 					  nullValue};	 // alternative result if anything other that array is expected
-			auto cengine				= get_conversion_engine();
-			const u16str wide_orcid = cengine.from_bytes(orcid);
+			const u16str wide_orcid = transcoding::to_utf16(orcid);
 
-			const auto safe_get
-				 = [&null_value, &cengine](const str& field, const jvalue& json) -> u16str {
+			const auto safe_get = [&null_value](const str& field, const jvalue& json) -> u16str {
 				const jvalue& element = json.get(field, null_value);
 				if(element == null_value) return u16str();
 				else
-					return cengine.from_bytes(element.asCString());
+					return transcoding::to_utf16(element.asCString());
 			};
 
-			do {
-				if(total_results) offset += count;
-				const connection_handler::raw_response_t response
-					 = send_request(prepare_request(orcid, offset, count));
-				dassert{response.first == drogon::ReqResult::Ok, "expected 200 response code"_u8};
-				log.info() << "successfully got response from `https://api.elsevier.com`"
-							  << logger::endl;
-
-				std::shared_ptr<jvalue> json{nullptr};
-				try
-				{
-					json = response.second->getJsonObject();
-				}
-				catch(const std::exception& e)
-				{
-					log.error() << "cought `std::exception` while gathering json. what(): "
-									<< logger::endl
-									<< e.what() << logger::endl;
-					throw;
-				}
-				catch(...)
-				{
-					log.error() << "cought unknown exception while gathering json" << logger::endl;
-					throw;
-				}
-
-				check_nullptr{json};
-
-				const jvalue& search_results = json->get("search-results", null_value);
-				dassert(search_results != null_value,
-						  "invalid input, no `search-results` field in json"_u8);
-
-				const jvalue& jtr = search_results.get("opensearch:totalResults", null_value);
-				dassert(jtr != null_value, "expected totalResults to be a numeric string"_u8);
-				total_results = std::stoi(jtr.asCString());
-				if(total_results == 0)
-				{
-					log.warn() << "for orcid: `" << orcid << "` got empty result set" << logger::endl;
-					return result_list;
-				}
-				else
-				{
-					log.info() << "got: " << std::min(offset + count, total_results) << " / "
-								  << total_results << logger::endl;
-				}
+			const jvalue& search_results = json.get("search-results", null_value);
+			dassert(search_results != null_value,
+					  "invalid input, no `search-results` field in json"_u8);
 
-				const jvalue& entry = search_results.get("entry", empty_array);
-				dassert(entry.isArray(), "entry has to be array"_u8);
-				for(const jvalue& obj: entry)
-				{
-					detail::json_repr_t x{};
+			const jvalue& jtr = search_results.get("opensearch:totalResults", null_value);
+			dassert(jtr != null_value, "expected totalResults to be a numeric string"_u8);
+			total_results = std::stoi(jtr.asCString());
+			if(total_results == 0)
+			{
+				log.warn() << "for orcid: `" << orcid << "` got empty result set" << logger::endl;
+				return list;
+			}
 
-					x.title = safe_get("dc:title", obj);
-					if(x.title.empty()) continue;
+			const jvalue& entry = search_results.get("entry", empty_array);
+			dassert(entry.isArray(), "entry has to be array"_u8);
+			for(const jvalue& obj: entry)
+			{
+				detail::json_repr_t x{};
 
-					x.year = safe_get("prism:coverDate", obj);
-					if(x.year.empty()) continue;
+				x.title = safe_get("dc:title", obj);
+				if(x.title.empty()) continue;
 
-					const u16str doi = safe_get("prism:doi", obj);
-					if(!doi.empty()) x.ids.emplace_back(std::make_pair(u"doi", doi));
+				x.year = safe_get("prism:coverDate", obj);
+				if(x.year.empty()) continue;
 
-					const u16str issn = safe_get("prism:issn", obj);
-					if(!issn.empty()) x.ids.emplace_back(std::make_pair(u"pissn", issn));
+				const u16str doi = safe_get("prism:doi", obj);
+				if(!doi.empty()) x.ids.emplace_back(std::make_pair(u"doi", doi));
 
-					const u16str eid = safe_get("eid", obj);
-					if(!eid.empty()) x.ids.emplace_back(std::make_pair(u"eid", eid));
+				const u16str issn = safe_get("prism:issn", obj);
+				if(!issn.empty()) x.ids.emplace_back(std::make_pair(u"pissn", issn));
 
-					x.orcid = wide_orcid;
-					x.print();
-					list.emplace_back(std::move(x));
-				}
+				const u16str eid = safe_get("eid", obj);
+				if(!eid.empty()) x.ids.emplace_back(std::make_pair(u"eid", eid));
 
-			} while(offset + count < total_results);
+				x.orcid = wide_orcid;
+				x.print();
+				list.emplace_back(std::move(x));
+			}
 
-			return result_list;
+			return list;
+		}
+
+		void scopus_adapter::get_person(const str& orcid, const page_callback_t& on_page)
+		{
+			constexpr size_t count{25};
+			size_t total_results{0};
+
+			// first page says how many pages are there
+			value_t first
+				 = parse_page(send_request(prepare_request(orcid, 0ul, count)), orcid, total_results);
+			if(total_results == 0) return;
+			log.info() << "got: " << std::min(count, total_results) << " / " << total_results
+						  << logger::endl;
+			on_page(first);
+
+			// rest of pages are independent, so they are downloaded concurrently
+			const size_t pages_count = (total_results + count - 1ul) / count - 1ul;
+			std::deque<std::future<raw_response_t>> in_flight;
+			size_t requested{0};
+
+			// pages are handed over in original order, while next ones are still downloaded
+			for(size_t i = 0; i < pages_count; ++i)
+			{
+				for(; requested < pages_count && in_flight.size() < max_in_flight(); ++requested)
+					in_flight.emplace_back(
+						 send_request_async(prepare_request(orcid, (requested + 1ul) * count, count)));
+
+				size_t ignored{0};
+				value_t page = parse_page(in_flight.front().get(), orcid, ignored);
+				in_flight.pop_front();
+
+				log.info() << "got: " << std::min((i + 2ul) * count, total_results) << " / "
+							  << total_results << logger::endl;
+				on_page(page);
+			}
+		}
+
+		void scopus_adapter::max_in_flight(const size_t value)
+		{
+			m_max_in_flight.store(std::clamp(value, size_t{1}, connections_count()));
 		}
 	}	 // namespace network
 }	 // namespace core
\ No newline at end of file
@@ -12,6 +12,7 @@
 // Project
 #include <antybiurokrata/libraries/demangler/demangler.h>
 #include <antybiurokrata/libraries/objects/processing_details.hpp>
+#include <antybiurokrata/libraries/objects/string_pool.h>
 
 namespace core
 {
@@ -30,6 +31,13 @@ namespace core
 			struct detail_orcid_t : public serial_helper_t
 			{
 				constexpr static size_t words_in_orcid_num{4ul};
+
+				/** @brief length of orcid string, words are separated with '-' */
+				constexpr static size_t orcid_length{words_in_orcid_num * 5ul - 1ul};
+
+				/** @brief last word with 'X' as check digit is stored as sum of this and its digits */
+				constexpr static uint16_t x_check_digit_base{10000u};
+
 				template<typename T> using fixed_orcid_array = std::array<T, words_in_orcid_num>;
 				dser<&detail_orcid_t::_, fixed_orcid_array<uint16_t>> identifier;
 
@@ -54,7 +62,7 @@ namespace core
 				 * 
 				 * @return u16str
 				*/
-				operator u16str() const { return get_conversion_engine().from_bytes(to_string(*this)); }
+				operator u16str() const { return transcoding::to_utf16(to_string(*this)); }
 
 				/**
 				 * @brief provides easy conversion to string
@@ -71,6 +79,14 @@ namespace core
 				 */
 				bool is_valid_orcid() const;
 
+				/**
+				 * @brief returns ISO 7064 MOD 11-2 check digit stored in given words
+				 *
+				 * @param words identifier of orcid
+				 * @return uint16_t 0-9, or 10 for 'X'
+				 */
+				static uint16_t check_digit(const fixed_orcid_array<uint16_t>& words) noexcept;
+
 				/**
 				 * @brief implementation of detail_orcid_t -> std::string conversion
 				 * 
@@ -80,7 +96,7 @@ namespace core
 				static str to_string(const detail_orcid_t& orcid);
 
 				/**
-				 * @brief checks is given string is proper as orcid
+				 * @brief checks is given string is proper as orcid, including its check digit
 				 * 
 				 * @param data orcid string to check
 				 * @param conversion_output [ = nullptr ] during validation, conversion is performed, it you need it further, conversion output will be saved here
@@ -91,7 +107,7 @@ namespace core
 															 str* conversion_output = nullptr);
 
 				/**
-				 * @brief checks is given string is proper as orcid
+				 * @brief checks is given string is proper as orcid, including its check digit
 				 * 
 				 * @param data orcid string to check
 				 * @return true if string is valid
@@ -165,8 +181,11 @@ namespace core
 			template<typename validator = default_validator, typename unifier = default_unifier>
 			struct detail_string_holder_t : public serial_helper_t
 			{
-				ser<&detail_string_holder_t::_, u16str> data;
-				u16str raw;
+				/** @brief unified string, equal strings share one copy from `string_pool_t` */
+				ser<&detail_string_holder_t::_, interned_u16str_t> data;
+
+				/** @brief string as it was given */
+				interned_u16str_t raw;
 
 				using custom_serialize	  = pd::string::serial;
 				using custom_deserialize  = pd::string::deserial;
@@ -192,17 +211,37 @@ namespace core
 					dassert(validate(v),
 							  "incoming data: `"_u16 + u16str{v}
 									+ "` cannot be set, it does not meet requirements!"_u16);
+					set_unified(v, unified(v));
+				}
+
+				/** @brief value, that `set` would store for given string; nothing is interned */
+				static u16str unified(const u16str_v& v)
+				{
 					const bool has_hashes{v.find(u'#') != u16str_v::npos};
 					const bool has_ampersands{v.find(u'&') != u16str_v::npos};
 					const bool has_percents{v.find(u'%') != u16str_v::npos};
-					data(v);
+					u16str value{v};
 
-					if(has_hashes && has_ampersands) demangler<>::mangle<conv_t::HTML>(data());
+					if(has_hashes && has_ampersands) demangler<>::mangle<conv_t::HTML>(value);
 					else if(has_percents)
-						demangler<>::mangle<conv_t::URL>(data());
+						demangler<>::mangle<conv_t::URL>(value);
+
+					unifier{value};
+					return value;
+				}
 
-					raw = v;
-					unifier{data()};
+				/**
+				 * @brief sets value prepared by `unified` and possibly processed further
+				 * 
+				 * @param v string as it was given
+				 * @param value unified string
+				 */
+				void set_unified(const u16str_v& v, const u16str_v& value)
+				{
+					data() = value;
+					if(data() == v) raw = data();
+					else
+						raw = v;
 				}
 
 				/** @brief 1) Construct a new detail detail_string_holder_t object from string view; forwards to 2 */
@@ -212,7 +251,7 @@ namespace core
 
 				/** @brief 2) Construct a new detail detail_string_holder_t object from string; forwards to 3 */
 				explicit detail_string_holder_t(const str& v) :
-					 detail_string_holder_t{core::get_conversion_engine().from_bytes(v)}
+					 detail_string_holder_t{core::transcoding::to_utf16(v)}
 				{
 				}
 
@@ -230,7 +269,7 @@ namespace core
 				/** @brief 2) forward to assign operator 3 */
 				detail_string_holder_t& operator=(const str& v)
 				{
-					return (*this = core::get_conversion_engine().from_bytes(v));
+					return (*this = core::transcoding::to_utf16(v));
 				}
 
 				/** @brief 3) actually constructs object */
@@ -244,7 +283,7 @@ namespace core
 				detail_string_holder_t& operator=(const u16str& v) { return (*this = u16str_v{v}); }
 
 				/** @brief provides conversion to u16string_view*/
-				operator u16str_v() const { return u16str_v{data()}; }
+				operator u16str_v() const { return u16str_v{data().get()}; }
 
 				/**
 				 * @brief provides conversion easy conversion with demangler
@@ -254,10 +293,10 @@ namespace core
 				*/
 				template<core::detail::conversion_t conv_t> u16str get_as() const
 				{
-					return core::demangler<u16str, u16str_v>{data()}.process<conv_t>().get_copy();
+					return core::demangler<u16str, u16str_v>{data().get()}.process<conv_t>().get_copy();
 				}
 
-				/** @brief forward equal operator */
+				/** @brief forward equal operator, compares handles of interned strings */
 				inline friend bool operator==(const detail_string_holder_t& s1,
 														const detail_string_holder_t& s2)
 				{
@@ -285,7 +324,10 @@ namespace core
 				 * 
 				 * @throw assert_exception if given string is not valid
 				 */
-				void validate() const { dassert{validate(data()), data() + ": is not valid name"_u16}; }
+				void validate() const
+				{
+					dassert{validate(data().get()), data().get() + u": is not valid name"};
+				}
 			};
 			template<typename validator = default_validator, typename unifier = default_unifier>
 			using string_holder_custom_t	= cser<&detail_string_holder_t<validator, unifier>::data>;
@@ -348,24 +390,59 @@ namespace core
 			using id_type_stringinizer = pd::enums::enum_stringinizer<id_type_translation_unit>;
 
 			/**
-			 * @brief wraps map that stores diffrent ids
+			 * @brief wraps fixed slots, one for every type of id
 			 */
 			struct detail_ids_storage_t : public serial_helper_t
 			{
-				pd::map_ser<&serial_helper_t::_, id_type, ids_string_t> data;
+				constexpr static size_t length = id_type_translation_unit::length;
+
+				pd::enum_slots_ser<&serial_helper_t::_, id_type, ids_string_t, length> data;
 
 				using ser_data_t = decltype(data);
 				using inner_t	  = typename ser_data_t::value_type;
 				inner_t* operator->() { return &(data()); }
 				const inner_t* operator->() const { return &(data()); }
 
-				using custom_serialize	 = pd::map_serial<id_type, ids_string_t>;
-				using custom_deserialize = pd::map_deserial<id_type, ids_string_t>;
+				using custom_serialize	 = pd::enum_slots_serial<id_type, ids_string_t, length>;
+				using custom_deserialize = pd::enum_slots_deserial<id_type, ids_string_t, length>;
 				using custom_pretty_print
-					 = pd::map_pretty_serial<id_type, ids_string_t, id_type_stringinizer>;
+					 = pd::enum_slots_pretty_serial<id_type, ids_string_t, length, id_type_stringinizer>;
 			};
 			using ids_storage_t = cser<&detail_ids_storage_t::data>;
 
+			/**
+			 * @brief compact summary of sanitized title and year, allows to reject different
+			 * publications on integers, before comparing strings
+			 */
+			struct title_fingerprint_t
+			{
+				/** @brief interned title, that fingerprint was calculated from; it is kept alive, so
+				 * its handle cannot be reused by other string */
+				interned_u16str_t source{};
+				uint64_t hash{0ul};
+				uint32_t length{0u};
+				uint16_t year{0u};
+
+				/**
+				 * @brief calculates fingerprint
+				 *
+				 * @param title sanitized title
+				 * @param year year of publication
+				 * @return title_fingerprint_t fingerprint
+				 */
+				static title_fingerprint_t make(const interned_u16str_t& title,
+														  const uint16_t year) noexcept;
+
+				/** @brief orders by year, length and hash; equal fingerprints can still differ in title */
+				inline friend std::strong_ordering operator<=>(const title_fingerprint_t& f1,
+																			  const title_fingerprint_t& f2) noexcept
+				{
+					if(const auto r = f1.year <=> f2.year; r != 0) return r;
+					if(const auto r = f1.length <=> f2.length; r != 0) return r;
+					return f1.hash <=> f2.hash;
+				}
+			};
+
 			/** @brief object representation of publication */
 			struct detail_publication_t : public serial_helper_t
 			{
@@ -374,6 +451,19 @@ namespace core
 				dser<&detail_publication_t::polish_title, uint16_t> year;
 				dser<&detail_publication_t::year, ids_storage_t> ids;
 
+				/** @brief not serialized, refreshed by ORM after sanitization of title */
+				title_fingerprint_t fingerprint{};
+
+				/** @brief recalculates fingerprint, call it after changing title or year */
+				void update_fingerprint() noexcept;
+
+				/**
+				 * @brief returns stored fingerprint if it is up to date (title and year were not changed
+				 * since last update), otherwise calculates it without storing, so it is safe to call it
+				 * concurrently
+				 */
+				title_fingerprint_t get_fingerprint() const noexcept;
+
 				/**
 				 * @brief compares two me with other
 				 * 
@@ -484,36 +574,24 @@ namespace core
 			using ser_match_type = pd::enums::enum_t<match_type_translation_unit>;
 
 			/**
-			 * @brief object representation of match
-			 */
-			struct detail_publication_with_source_t : public serial_helper_t
-			{
-				dser<&detail_publication_with_source_t::_, ser_match_type> source;
-				dser<&detail_publication_with_source_t::source, shared_publication_t> publication{};
-
-				/** @brief redirect all comprasion operators */
-				inline friend auto operator<=>(const detail_publication_with_source_t& pws1,
-														 const detail_publication_with_source_t& pws2)
-				{
-					return pws1.source()().data() <=> pws2.source()().data();
-				}
-			};
-			using publication_with_source_t = cser<&detail_publication_with_source_t::publication>;
-
-
-			/**
-			 * @brief container with unique values
+			 * @brief matched publications, at most one for every data source, presence is kept in bitmask
 			 */
 			struct detail_sourced_publication_storage_t : serial_helper_t
 			{
-				using item_t  = publication_with_source_t;
-				using inner_t = std::set<item_t>;
+				constexpr static size_t length = match_type_translation_unit::length;
+				using match_type_stringinizer
+					 = pd::enums::enum_stringinizer<match_type_translation_unit>;
+
+				using inner_t = pd::enum_slots_t<match_type, shared_publication_t, length>;
 				dser<&detail_sourced_publication_storage_t::_, inner_t> data;
 
-				using putter_t				  = pd::collection::emplacer<std::set, item_t>;
-				using custom_serialize	  = pd::collection::serial<std::set, item_t>;
-				using custom_deserialize  = pd::collection::deserial<putter_t, std::set, item_t>;
-				using custom_pretty_print = pd::collection::pretty_print<std::set, item_t>;
+				using custom_serialize
+					 = pd::enum_slots_serial<match_type, shared_publication_t, length>;
+				using custom_deserialize
+					 = pd::enum_slots_deserial<match_type, shared_publication_t, length>;
+				using custom_pretty_print
+					 = pd::enum_slots_pretty_serial<match_type, shared_publication_t, length,
+															  match_type_stringinizer>;
 			};
 			using sourced_publication_storage_t = cser<&detail_sourced_publication_storage_t::data>;
 
@@ -537,7 +615,6 @@ namespace core
 		using typename detail::polish_name_t;
 		using publication_summary_t = detail::shared_publication_summary_t;
 		using typename detail::publication_t;
-		using typename detail::publication_with_source_t;
 		using typename detail::shared_person_t;
 		using typename detail::shared_publication_t;
 	}	 // namespace objects
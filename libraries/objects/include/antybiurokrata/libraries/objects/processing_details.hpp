@@ -10,8 +10,11 @@
  */
 
 #include <antybiurokrata/libraries/patterns/seiralizer.hpp>
+#include <antybiurokrata/libraries/patterns/binary_serializer.hpp>
+#include <antybiurokrata/libraries/objects/string_pool.h>
 #include <iomanip>
 #include <array>
+#include <bit>
 #include <set>
 #include <map>
 
@@ -185,6 +188,13 @@ namespace core
 						os << view.size() << delimiter;
 						for(const auto c: view) os << static_cast<int>(c) << delimiter;
 					}
+
+					/** @brief same as above, for interned strings */
+					template<typename stream_type>
+					serial(stream_type& os, const detail::interned_u16str_t& value) :
+						 serial{os, u16str_v{value.get()}}
+					{
+					}
 				};
 
 				/**
@@ -208,6 +218,15 @@ namespace core
 							out += static_cast<u16char_t>(c);
 						}
 					}
+
+					/** @brief same as above, for interned strings */
+					template<typename stream_type>
+					deserial(stream_type& is, detail::interned_u16str_t& out)
+					{
+						u16str value;
+						deserial{is, value};
+						out = value;
+					}
 				};
 
 				/** @brief pretty-printing of wide stirng (just proxy to conversion) */
@@ -216,7 +235,14 @@ namespace core
 				{
 					template<typename stream_type> pretty_print(stream_type& os, const u16str_v& view)
 					{
-						os << get_conversion_engine().to_bytes(view.data());
+						os << transcoding::to_utf8(view);
+					}
+
+					/** @brief same as above, for interned strings */
+					template<typename stream_type>
+					pretty_print(stream_type& os, const detail::interned_u16str_t& value) :
+						 pretty_print{os, u16str_v{value.get()}}
+					{
 					}
 				};
 			}	 // namespace string
@@ -471,6 +497,190 @@ namespace core
 														elem_t, const coll_t<elem_t, args...>&, args...>;
 			};	  // namespace collection
 
+			/**
+			 * @brief map with keys from small enum; values are stored in fixed array indexed by key
+			 * and presence of keys is kept in bitmask, so lookups are O(1) and checking for common keys
+			 * is single AND
+			 * 
+			 * @tparam Key enum, all keys are lower than `length`
+			 * @tparam Value any default constructible type
+			 * @tparam length amount of possible keys
+			 */
+			template<typename Key, typename Value, size_t length> class enum_slots_t
+			{
+			 public:
+				using mask_t = uint32_t;
+				static_assert(length <= std::numeric_limits<mask_t>::digits, "too many keys for mask");
+
+				/** @brief iterates over present keys in ascending order, yields pairs of key and value */
+				class const_iterator
+				{
+				 public:
+					using value_type = std::pair<Key, const Value&>;
+
+					const_iterator(const enum_slots_t* owner, const mask_t left) :
+						 m_owner{owner},
+						 m_left{left}
+					{
+					}
+
+					value_type operator*() const
+					{
+						const size_t i = static_cast<size_t>(std::countr_zero(m_left));
+						return value_type{static_cast<Key>(i), m_owner->m_slots[i]};
+					}
+
+					const_iterator& operator++()
+					{
+						m_left &= m_left - 1u;
+						return *this;
+					}
+
+					inline friend bool operator==(const const_iterator& it1, const const_iterator& it2)
+					{
+						return it1.m_left == it2.m_left;
+					}
+
+				 private:
+					const enum_slots_t* m_owner;
+					mask_t m_left;
+				};
+
+				/** @brief bit of given key */
+				constexpr static mask_t bit(const Key key) noexcept
+				{
+					return mask_t{1} << static_cast<mask_t>(key);
+				}
+
+				/** @brief returns value under given key, key is marked as present */
+				Value& operator[](const Key key)
+				{
+					dassert{static_cast<size_t>(key) < length, "key out of range"_u8};
+					m_mask |= bit(key);
+					return m_slots[static_cast<size_t>(key)];
+				}
+
+				/**
+				 * @brief inserts value under given key, if it is missing
+				 * 
+				 * @return true if value was inserted, false if key was already present
+				 */
+				template<typename V> bool emplace(const Key key, V&& value)
+				{
+					if(contains(key)) return false;
+					(*this)[key] = std::forward<V>(value);
+					return true;
+				}
+
+				/** @brief returns pointer to value under given key, nullptr if key is missing */
+				const Value* find(const Key key) const noexcept
+				{
+					return contains(key) ? &m_slots[static_cast<size_t>(key)] : nullptr;
+				}
+
+				bool contains(const Key key) const noexcept
+				{
+					return static_cast<size_t>(key) < length && (m_mask & bit(key)) != 0;
+				}
+
+				/** @brief marks key as missing, value is reset */
+				void erase(const Key key)
+				{
+					if(!contains(key)) return;
+					m_mask &= ~bit(key);
+					m_slots[static_cast<size_t>(key)] = Value{};
+				}
+
+				void clear()
+				{
+					m_mask	= 0u;
+					m_slots = std::array<Value, length>{};
+				}
+
+				/** @brief bit `1 << key` is set for every present key */
+				mask_t mask() const noexcept { return m_mask; }
+				size_t size() const noexcept { return static_cast<size_t>(std::popcount(m_mask)); }
+				bool empty() const noexcept { return m_mask == 0u; }
+
+				const_iterator begin() const noexcept { return const_iterator{this, m_mask}; }
+				const_iterator end() const noexcept { return const_iterator{this, 0u}; }
+
+				inline friend bool operator==(const enum_slots_t& s1, const enum_slots_t& s2)
+				{
+					if(s1.m_mask != s2.m_mask) return false;
+					for(const auto& pair: s1)
+						if(!(pair.second == s2.m_slots[static_cast<size_t>(pair.first)])) return false;
+					return true;
+				}
+
+			 private:
+				std::array<Value, length> m_slots{};
+				mask_t m_mask{0u};
+			};
+
+			/**
+			 * @brief definition of serializing enum slots, format is the same as for map
+			 * 
+			 * @tparam T any type
+			 */
+			template<typename Key, typename Value, size_t length> struct enum_slots_serial
+			{
+				template<typename stream_type>
+				enum_slots_serial(stream_type& os, const enum_slots_t<Key, Value, length>& data)
+				{
+					using patterns::serial::delimiter;
+					os << data.size() << delimiter;
+					for(const auto& pair: data)
+						os << static_cast<size_t>(pair.first) << delimiter << pair.second << delimiter;
+				}
+			};
+
+			/**
+			 * @brief definition of deserializing enum slots
+			 * 
+			 * @tparam T any type
+			 */
+			template<typename Key, typename Value, size_t length> struct enum_slots_deserial
+			{
+				template<typename stream_type>
+				enum_slots_deserial(stream_type& is, enum_slots_t<Key, Value, length>& data)
+				{
+					size_t size;
+					is >> size;
+					drop_delimiter(is);
+					for(size_t i = 0; i < size; ++i)
+					{
+						size_t key;
+						is >> key;
+						drop_delimiter(is);
+						Value val;
+						is >> val;
+						drop_delimiter(is);
+						dassert{key < length, "invalid key of enum slots"_u8};
+						data[static_cast<Key>(key)] = std::move(val);
+					}
+				}
+			};
+
+			/**
+			 * @brief definition of pretty serializing enum slots
+			 * 
+			 * @tparam T any type
+			 */
+			template<typename Key, typename Value, size_t length, typename key_pretty_printer>
+			struct enum_slots_pretty_serial
+			{
+				template<typename stream_type>
+				enum_slots_pretty_serial(stream_type& os, const enum_slots_t<Key, Value, length>& data)
+				{
+					os << '[';
+					for(auto it = data.begin(); it != data.end(); ++it)
+						os << ","[it == data.begin()] << " ( " << key_pretty_printer{(*it).first} << " : "
+							<< patterns::serial::pretty_print{(*it).second} << " )";
+					os << " ]";
+				}
+			};
+
 			/**
 			 * @brief definition of serializing map
 			 * 
@@ -615,7 +825,7 @@ namespace core
 					template<typename stream_t>
 					inline friend stream_t& operator<<(stream_t& os, const enum_stringinizer& x)
 					{
-						return os << get_conversion_engine().to_bytes(get(x.x));
+						return os << transcoding::to_utf8(get(x.x));
 					}
 				};
 
@@ -673,7 +883,58 @@ namespace core
 			 */
 			template<auto X, typename Key, typename Value>
 			using map_ser								= ser<X, std::map<Key, Value>>;
+			template<auto X, typename Key, typename Value, size_t length>
+			using enum_slots_ser = ser<X, enum_slots_t<Key, Value, length>>;
 			template<typename T> using shared_t = shared::single_member_shared_struct_helper<T>;
 		}	 // namespace processing_details
 	}		 // namespace objects
-}	 // namespace core
\ No newline at end of file
+}	 // namespace core
+namespace patterns
+{
+	namespace serial
+	{
+		namespace binary
+		{
+			/** @brief interned strings are stored as plain strings and interned again while reading */
+			template<> struct io<core::objects::detail::interned_u16str_t>
+			{
+				static void put(std::ostream& os, const core::objects::detail::interned_u16str_t& value)
+				{
+					binary::put(os, value.get());
+				}
+
+				static void get(std::istream& is, core::objects::detail::interned_u16str_t& value)
+				{
+					core::u16str tmp;
+					binary::get(is, tmp);
+					value = tmp;
+				}
+			};
+
+			/** @brief enum slots are stored as mask and following present values */
+			template<typename Key, typename Value, size_t length>
+			struct io<core::objects::processing_details::enum_slots_t<Key, Value, length>>
+			{
+				using slots_t = core::objects::processing_details::enum_slots_t<Key, Value, length>;
+
+				static void put(std::ostream& os, const slots_t& value)
+				{
+					write_raw<typename slots_t::mask_t>(os, value.mask());
+					for(const auto& pair: value) binary::put(os, pair.second);
+				}
+
+				static void get(std::istream& is, slots_t& value)
+				{
+					value.clear();
+					typename slots_t::mask_t mask = read_raw<typename slots_t::mask_t>(is);
+					for(; mask != 0u; mask &= mask - 1u)
+					{
+						const size_t i = static_cast<size_t>(std::countr_zero(mask));
+						if(i >= length) throw std::runtime_error{"invalid mask of enum slots"};
+						binary::get(is, value[static_cast<Key>(i)]);
+					}
+				}
+			};
+		}	 // namespace binary
+	}		 // namespace serial
+}	 // namespace patterns
@@ -0,0 +1,161 @@
+/**
+ * @file string_pool.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains pool of interned strings, shared by all string holders
+ *
+ * @copyright Copyright (c) 2021
+ *
+*/
+
+#pragma once
+
+// Project includes
+#include <antybiurokrata/types.hpp>
+
+// STL
+#include <atomic>
+#include <compare>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace core
+{
+	namespace objects
+	{
+		namespace detail
+		{
+			/**
+			 * @brief thread-safe set of unique strings; every string is counted by handles pointing to
+			 * it and is released with the last of them, so equal strings that are alive at the same
+			 * time always have the same handle
+			 */
+			class string_pool_t : public Log<string_pool_t>
+			{
+				using Log<string_pool_t>::log;
+
+			 public:
+				/** @brief interned string with amount of handles pointing to it */
+				struct entry_t
+				{
+					const u16str value;
+					mutable std::atomic<size_t> references{0ul};
+				};
+
+			 private:
+				/** @brief owns entries, views are on their values */
+				std::unordered_map<u16str_v, std::unique_ptr<entry_t>> m_index;
+
+				/** @brief shared by all empty strings, it is not counted and never released */
+				entry_t m_empty{};
+
+				mutable std::shared_mutex m_mtx;
+
+			 public:
+				/**
+				 * @brief finds given string in pool, or adds it
+				 *
+				 * @param value string to intern
+				 * @return const entry_t* handle, the same for all equal strings; caller owns one
+				 * reference and has to `release` it
+				 */
+				const entry_t* intern(const u16str_v& value);
+
+				/** @brief adds reference to already interned string */
+				void add_reference(const entry_t* entry) const noexcept
+				{
+					if(entry != empty()) entry->references.fetch_add(1ul, std::memory_order_relaxed);
+				}
+
+				/** @brief drops reference, string is removed from pool with the last one */
+				void release(const entry_t* entry) noexcept;
+
+				/** @brief amount of unique strings in pool */
+				size_t size() const;
+
+				/** @brief handle of empty string, does not require lookup */
+				const entry_t* empty() const noexcept { return &m_empty; }
+
+				/** @brief pool used by all string holders */
+				static string_pool_t& global();
+			};
+
+			/**
+			 * @brief immutable string from global pool; comparing for equality costs as much as for
+			 * pointer, copying as for atomic counter, ordering is the same as for u16str
+			 */
+			class interned_u16str_t
+			{
+				const string_pool_t::entry_t* m_entry;
+
+				static string_pool_t& pool() noexcept { return string_pool_t::global(); }
+
+			 public:
+				interned_u16str_t() noexcept : m_entry{pool().empty()} {}
+				explicit interned_u16str_t(const u16str_v& value) : m_entry{pool().intern(value)} {}
+				explicit interned_u16str_t(const u16str& value) : interned_u16str_t{u16str_v{value}} {}
+
+				interned_u16str_t(const interned_u16str_t& that) noexcept : m_entry{that.m_entry}
+				{
+					pool().add_reference(m_entry);
+				}
+				interned_u16str_t(interned_u16str_t&& that) noexcept :
+					 m_entry{std::exchange(that.m_entry, pool().empty())}
+				{
+				}
+
+				~interned_u16str_t() { pool().release(m_entry); }
+
+				interned_u16str_t& operator=(const interned_u16str_t& that) noexcept
+				{
+					if(m_entry == that.m_entry) return *this;
+					pool().add_reference(that.m_entry);
+					pool().release(std::exchange(m_entry, that.m_entry));
+					return *this;
+				}
+				interned_u16str_t& operator=(interned_u16str_t&& that) noexcept
+				{
+					std::swap(m_entry, that.m_entry);
+					return *this;
+				}
+
+				/** @brief interns given string */
+				interned_u16str_t& operator=(const u16str_v& value)
+				{
+					pool().release(std::exchange(m_entry, pool().intern(value)));
+					return *this;
+				}
+
+				/** @brief interned string */
+				const u16str& get() const noexcept { return m_entry->value; }
+				operator const u16str&() const noexcept { return m_entry->value; }
+
+				/** @brief handle of string, equal for all equal strings alive at the same time */
+				const u16str* handle() const noexcept { return &m_entry->value; }
+
+				size_t size() const noexcept { return get().size(); }
+				bool empty() const noexcept { return get().empty(); }
+
+				inline friend bool operator==(const interned_u16str_t& s1,
+														const interned_u16str_t& s2) noexcept
+				{
+					return s1.m_entry == s2.m_entry;
+				}
+
+				inline friend std::strong_ordering operator<=>(const interned_u16str_t& s1,
+																			  const interned_u16str_t& s2) noexcept
+				{
+					if(s1.m_entry == s2.m_entry) return std::strong_ordering::equal;
+					return s1.get() <=> s2.get();
+				}
+
+				/** @brief compares content, without interning other string */
+				inline friend bool operator==(const interned_u16str_t& s1, const u16str_v& s2) noexcept
+				{
+					return u16str_v{s1.get()} == s2;
+				}
+			};
+		}	 // namespace detail
+	}		 // namespace objects
+}	 // namespace core
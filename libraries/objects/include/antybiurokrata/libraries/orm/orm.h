@@ -11,6 +11,9 @@
 
 #pragma once
 
+// STL
+#include <unordered_map>
+
 // Project includes
 #include <antybiurokrata/libraries/global_adapters.hpp>
 #include <antybiurokrata/libraries/objects/objects.h>
@@ -25,7 +28,74 @@ namespace core
 
 		using shared_person_t		= objects::shared_person_t;
 		using shared_publication_t = objects::shared_publication_t;
-		using persons_storage_t		= std::shared_ptr<std::set<shared_person_t>>;
+
+		/**
+		 * @brief unique persons, indexed by orcid and by unified name and surname
+		 * 
+		 * @remark persons are identified as by `detail_person_t::operator<`: by orcid if both persons
+		 * have valid one, otherwise by name and surname; every person gets integer id, which is its
+		 * position in order of insertion
+		 */
+		class persons_registry_t
+		{
+		 public:
+			using person_id_t		= uint32_t;
+			using const_iterator = std::vector<shared_person_t>::const_iterator;
+
+			/** @brief returned if person was not found */
+			constexpr static person_id_t npos = std::numeric_limits<person_id_t>::max();
+
+			/**
+			 * @brief adds person, if it is not known yet
+			 * 
+			 * @param person person to add
+			 * @return std::pair<person_id_t, bool> id of added or already known person and true if
+			 * person was added
+			 */
+			std::pair<person_id_t, bool> insert(const shared_person_t& person);
+
+			/**
+			 * @brief looks for person equal to given one
+			 * 
+			 * @param person person to look for
+			 * @return person_id_t id of found person or `npos`
+			 */
+			person_id_t find(const person_t& person) const;
+
+			/** @brief returns person with given id */
+			const shared_person_t& operator[](const person_id_t id) const { return m_persons[id]; }
+
+			size_t size() const noexcept { return m_persons.size(); }
+			bool empty() const noexcept { return m_persons.empty(); }
+
+			const_iterator begin() const noexcept { return m_persons.begin(); }
+			const_iterator end() const noexcept { return m_persons.end(); }
+
+		 private:
+			/** @brief unified, interned name and surname */
+			struct name_key_t
+			{
+				const u16str* name;
+				const u16str* surname;
+
+				inline friend bool operator==(const name_key_t&, const name_key_t&) = default;
+			};
+
+			/** @brief hashes keys by handles of interned strings */
+			struct name_key_hash_t
+			{
+				size_t operator()(const name_key_t& key) const noexcept;
+			};
+
+			/** @brief all four words of orcid, in one integer */
+			static uint64_t orcid_key(const person_t& person) noexcept;
+			static name_key_t name_key(const person_t& person) noexcept;
+
+			std::vector<shared_person_t> m_persons;
+			std::unordered_map<uint64_t, person_id_t> m_by_orcid;
+			std::unordered_map<name_key_t, std::vector<person_id_t>, name_key_hash_t> m_by_name;
+		};
+		using persons_storage_t = std::shared_ptr<persons_registry_t>;
 
 		/**
 		 * @brief constructs person_t objects, by visiting output from adapters
@@ -1,15 +1,62 @@
 // STL
 #include <ranges>
-#include <regex>
 #include <charconv>
-#include <iomanip>
 
 // Project
 #include <antybiurokrata/libraries/objects/objects.h>
+#include <antybiurokrata/character_tables.hpp>
 namespace core
 {
 	namespace objects
 	{
+		namespace
+		{
+			using orcid_words_t = detail::detail_orcid_t::fixed_orcid_array<uint16_t>;
+
+			/**
+			 * @brief parses and validates orcid in one pass: format is `dddd-dddd-dddd-dddc`, where
+			 * `c` is ISO 7064 MOD 11-2 check digit (`0`-`9` or `X`) of preceding 15 digits
+			 *
+			 * @tparam char_t type of characters
+			 * @param data orcid string
+			 * @param output [out] parsed words, left unchanged on failure
+			 * @return true if string is valid
+			 */
+			template<typename char_t>
+			bool parse_orcid(const std::basic_string_view<char_t> data, orcid_words_t& output) noexcept
+			{
+				using orcid_t = detail::detail_orcid_t;
+				if(data.size() != orcid_t::orcid_length) return false;
+
+				orcid_words_t words{};
+				uint32_t total = 0u;
+				for(size_t i = 0; i < orcid_t::orcid_length; ++i)
+				{
+					const char_t c = data[i];
+					if(i % 5ul == 4ul)
+					{
+						if(c != static_cast<char_t>('-')) return false;
+						continue;
+					}
+
+					uint16_t& word = words[i / 5ul];
+					if(c >= static_cast<char_t>('0') && c <= static_cast<char_t>('9'))
+						word = word * 10u + static_cast<uint16_t>(c - static_cast<char_t>('0'));
+					else if(i == orcid_t::orcid_length - 1ul && c == static_cast<char_t>('X'))
+						word += orcid_t::x_check_digit_base;
+					else
+						return false;
+
+					if(i != orcid_t::orcid_length - 1ul)
+						total = (total + static_cast<uint32_t>(c - static_cast<char_t>('0'))) * 2u;
+				}
+
+				if(orcid_t::check_digit(words) != (12u - total % 11u) % 11u) return false;
+
+				output = words;
+				return true;
+			}
+		}	 // namespace
 
 		bool detail::detail_orcid_t::is_valid_orcid() const
 		{
@@ -18,63 +65,70 @@ namespace core
 			return sum > 0;
 		}
 
+		uint16_t
+			 detail::detail_orcid_t::check_digit(const fixed_orcid_array<uint16_t>& words) noexcept
+		{
+			const uint16_t last = words.back();
+			return last >= x_check_digit_base ? 10u : last % 10u;
+		}
+
 		str detail::detail_orcid_t::to_string(const detail::detail_orcid_t& orcid)
 		{
-			std::stringstream result;
-			for(auto it = orcid.identifier().begin(); it != orcid.identifier().end(); it++)
+			str result(orcid_length, '-');
+			for(size_t i = 0; i < words_in_orcid_num; ++i)
 			{
-				if(it != orcid.identifier().begin()) result << std::setw(1) << '-';
-				result << std::setfill('0') << std::setw(4) << std::to_string(*it);
+				uint16_t word = orcid.identifier()[i];
+				char* out	  = result.data() + i * 5ul + 3ul;	// filled from the last digit
+				size_t digits = 4ul;
+				if(word >= x_check_digit_base)
+				{
+					word -= x_check_digit_base;
+					*(out--) = 'X';
+					--digits;
+				}
+
+				for(; digits > 0ul; --digits, word /= 10u)
+					*(out--) = static_cast<char>('0' + word % 10u);
 			}
-			return result.str();
+			return result;
 		}
 
 		bool detail::detail_orcid_t::is_valid_orcid_string(const u16str_v& data,
 																			str* conversion_output)
 		{
-			const str conv{get_conversion_engine().to_bytes(u16str(data))};
-			if(conversion_output) *conversion_output = conv;
-			return is_valid_orcid_string(conv);
+			orcid_words_t words;
+			const bool valid = parse_orcid(data, words);
+
+			// valid orcid is plain ASCII, so it can be narrowed without transcoding
+			if(conversion_output)
+			{
+				if(valid) conversion_output->assign(data.begin(), data.end());
+				else
+					*conversion_output = transcoding::to_utf8(data);
+			}
+			return valid;
 		}
 
 
 		bool detail::detail_orcid_t::is_valid_orcid_string(const str_v& data)
 		{
-			const static std::regex orcid_validator_regex{"([0-9]{4}-){3}[0-9]{4}"};
-			if(data.empty() || data.size() > (words_in_orcid_num * 4) + (words_in_orcid_num - 1))
-				return false;
-			const str x{data};
-			return std::regex_match(x, orcid_validator_regex);
+			orcid_words_t words;
+			return parse_orcid(data, words);
 		}
 
 		detail::detail_orcid_t detail::detail_orcid_t::from_string(const u16str_v& data)
 		{
-			str conv;
-			dassert{is_valid_orcid_string(data, &conv), "given string is not valid ORCID number"_u8};
 			detail_orcid_t result{};
-
-			size_t i = 0;
-			for(str_v part: string_utils::split_words<str_v>{conv, '-'})
-			{
-				dassert(i < detail_orcid_t::words_in_orcid_num, "out of range"_u8);
-				result.identifier()[i++] = static_cast<uint16_t>(std::stoi(part.data()));
-			}
-
+			const bool valid = parse_orcid(data, result.identifier());
+			dassert{valid, "given string is not valid ORCID number"_u8};
 			return result;
 		}
 
 		detail::detail_orcid_t detail::detail_orcid_t::from_string(const str_v& data)
 		{
-			dassert{is_valid_orcid_string(data), "given string is not valid ORCID number"_u8};
 			detail_orcid_t result{};
-
-			size_t i = 0;
-			for(str_v part: string_utils::split_words<str_v>{data, '-'})
-			{
-				dassert(i < detail_orcid_t::words_in_orcid_num, "out of range"_u8);
-				result.identifier()[i++] = static_cast<uint16_t>(std::stoi(part.data()));
-			}
-
+			const bool valid = parse_orcid(data, result.identifier());
+			dassert{valid, "given string is not valid ORCID number"_u8};
 			return result;
 		}
 
@@ -85,7 +139,7 @@ namespace core
 			bool bad_last = false;	 // '-' cannot be at the end of surname
 			for(const u16char_t c: x)
 			{
-				const bool is_letter{std::isalpha(static_cast<wchar_t>(c), plPL())};
+				const bool is_letter{characters::is_alpha(c)};
 				const bool is_allowed_char{allowed.find(c) != u16str_v::npos};
 				if(is_allowed_char) bad_last = true;
 				else
@@ -99,18 +153,32 @@ namespace core
 
 		detail::polish_unifier::polish_unifier(u16str& x) noexcept
 		{
-			const auto ll = plPL();
-			for(u16char_t& c: x) c = static_cast<u16char_t>(std::toupper(static_cast<wchar_t>(c), ll));
+			for(u16char_t& c: x) c = characters::to_upper(c);
 		}
 
 		detail::ids_unifier::ids_unifier(u16str& x) noexcept
 		{
-			const auto ll = plPL();
 			for(u16char_t& c: x)
-			{
-				const wchar_t wc = c;
-				if(std::iswalnum(wc)) c = static_cast<u16char_t>(std::toupper(wc, ll));
-			}
+				if(characters::is_alnum(c)) c = characters::to_upper(c);
+		}
+
+		detail::title_fingerprint_t detail::title_fingerprint_t::make(const interned_u16str_t& title,
+																					const uint16_t year) noexcept
+		{
+			return title_fingerprint_t{title, std::hash<u16str_v>{}(title.get()),
+												static_cast<uint32_t>(title.size()), year};
+		}
+
+		void detail::detail_publication_t::update_fingerprint() noexcept
+		{
+			fingerprint = title_fingerprint_t::make(title()().data(), year());
+		}
+
+		detail::title_fingerprint_t detail::detail_publication_t::get_fingerprint() const noexcept
+		{
+			if(fingerprint.source == title()().data() && fingerprint.year == year())
+				[[likely]] return fingerprint;
+			return title_fingerprint_t::make(title()().data(), year());
 		}
 
 		int detail::detail_publication_t::compare(const detail::detail_publication_t& that) const
@@ -124,28 +192,27 @@ namespace core
 			};
 			const detail::detail_publication_t& me = *this;	  // alias, to make it handy
 
-			if(me.ids()()->size() > 0 && that.ids()()->size() > 0)
+			// the lowest common type of id decides
+			if(const auto common = me.ids()()->mask() & that.ids()()->mask(); common != 0u)
 			{
-				for(const auto& pair: me.ids()().data())
-				{
-					const auto found = that.ids()()->find(pair.first);
-					if(found != that.ids()()->end()) /* if found */
-						return calc(pair.second(), found->second());
-				}
+				const auto type = static_cast<id_type>(std::countr_zero(common));
+				return calc((*me.ids()()->find(type))(), (*that.ids()()->find(type))());
 			}
 
-			// worst case
-			const int r_year = calc(me.year, that.year);
-			if(r_year == 0)
-			{
-				const int r_title = calc(me.title()(), that.title()());
-				if(r_title == 0 && !me.polish_title()()->empty() && !that.polish_title()()->empty())
-					return calc(me.polish_title()(), that.polish_title()());
-				else
-					return r_title;
-			}
+			// worst case, year, length and hash of title are compared first
+			const title_fingerprint_t my_fingerprint	  = me.get_fingerprint();
+			const title_fingerprint_t that_fingerprint = that.get_fingerprint();
+			const int r_fingerprint							  = calc(my_fingerprint, that_fingerprint);
+			if(r_fingerprint != 0) return r_fingerprint;
+
+			// titles are interned, so different handles with equal fingerprint means hash collision
+			if(my_fingerprint.source != that_fingerprint.source)
+				if(const int r_title = calc(me.title()(), that.title()()); r_title != 0) return r_title;
+
+			if(!me.polish_title()()->empty() && !that.polish_title()()->empty())
+				return calc(me.polish_title()(), that.polish_title()());
 			else
-				return r_year;
+				return 0;
 		}
 
 	}	 // namespace objects
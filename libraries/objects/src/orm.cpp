@@ -6,20 +6,78 @@ namespace core
 {
 	namespace orm
 	{
+		namespace
+		{
+			/** @brief sets sanitized value of string holder, so not sanitized one is never interned */
+			template<typename holder_t> void set_sanitized(holder_t& holder, const u16str_v raw)
+			{
+				u16str value{holder_t::unified(raw)};
+				demangler<>::sanitize(value);
+				holder.set_unified(raw, value);
+			}
+		}	 // namespace
+
+		size_t persons_registry_t::name_key_hash_t::operator()(const name_key_t& key) const noexcept
+		{
+			const size_t h1 = std::hash<const u16str*>{}(key.name);
+			const size_t h2 = std::hash<const u16str*>{}(key.surname);
+			return h1 ^ (h2 + 0x9e3779b97f4a7c15ul + (h1 << 6) + (h1 >> 2));
+		}
+
+		uint64_t persons_registry_t::orcid_key(const person_t& person) noexcept
+		{
+			uint64_t result = 0ul;
+			for(const uint16_t word: person().orcid()().identifier()) result = (result << 16) | word;
+			return result;
+		}
+
+		persons_registry_t::name_key_t persons_registry_t::name_key(const person_t& person) noexcept
+		{
+			return name_key_t{person().name()().data().handle(), person().surname()().data().handle()};
+		}
+
+		persons_registry_t::person_id_t persons_registry_t::find(const person_t& person) const
+		{
+			const bool has_orcid = person().orcid()().is_valid_orcid();
+			if(has_orcid)
+				if(const auto found = m_by_orcid.find(orcid_key(person)); found != m_by_orcid.end())
+					return found->second;
+
+			// persons with different, valid orcids are different, even if they have the same names
+			const auto found = m_by_name.find(name_key(person));
+			if(found == m_by_name.end()) return npos;
+			for(const person_id_t id: found->second)
+				if(!has_orcid || !(*m_persons[id]())().orcid()().is_valid_orcid()) return id;
+			return npos;
+		}
+
+		std::pair<persons_registry_t::person_id_t, bool>
+			 persons_registry_t::insert(const shared_person_t& person)
+		{
+			check_nullptr{person().data()};
+			const person_t& p = *person();
+			if(const person_id_t id = find(p); id != npos) return {id, false};
+
+			const person_id_t id = static_cast<person_id_t>(m_persons.size());
+			m_persons.push_back(person);
+			if(p().orcid()().is_valid_orcid()) m_by_orcid.emplace(orcid_key(p), id);
+			m_by_name[name_key(p)].push_back(id);
+			return {id, true};
+		}
+
 		bool persons_extractor_t::visit(bgpolsl_repr_t* ptr)
 		{
 			check_nullptr{ptr};
-			shared_person_t result;
 
 			const u16str_v affiliation{ptr->affiliation};	// alias
-			auto& person				= result().data();		// alias
-			const auto reset_person = [&person] { person.reset(new person_t{}); };
 			for(u16str_v part_of_affiliation: string_utils::split_words<u16str_v>{affiliation, u','})
 			{
 				if(part_of_affiliation.empty()) continue;
 				const string_utils::split_words<u16str_v> splitter{part_of_affiliation, u' '};
 				auto it = splitter.begin();
-				reset_person();
+
+				// filled on stack, copied to heap only if it is not known yet
+				person_t person{};
 
 				u16str_v v				  = (it == splitter.end() ? u"" : *it);
 				const auto safely_move = [&]() -> bool {
@@ -29,7 +87,7 @@ namespace core
 					return true;
 				};
 
-				if(polish_name_t::value_t::validate(v)) (*person)().surname(v);
+				if(polish_name_t::value_t::validate(v)) person().surname(v);
 				else
 				{
 					log.warn() << "failed validation on surname: " << v << logger::endl;
@@ -38,7 +96,7 @@ namespace core
 
 				if(!safely_move()) continue;
 
-				if(polish_name_t::value_t::validate(v)) (*person)().name(v);
+				if(polish_name_t::value_t::validate(v)) person().name(v);
 				else
 				{
 					log.warn() << "failed validation on name: " << v << logger::endl;
@@ -48,19 +106,23 @@ namespace core
 				if(!safely_move()) continue;
 
 				if(orcid_t::value_t::is_valid_orcid_string(v))
-					(*person)().orcid(orcid_t::value_t::from_string(v));
+					person().orcid(orcid_t::value_t::from_string(v));
 				else
 				{
 					log.warn() << "failed validation on orcid: " << v << logger::endl;
 					continue;
 				}
 
-				auto pair = this->persons->insert(result);
-				if(pair.second)
+				auto id = this->persons->find(person);
+				if(id == persons_registry_t::npos)
+				{
+					const shared_person_t added{std::make_shared<person_t>(std::move(person))};
+					id = this->persons->insert(added).first;
 					log.info() << "successfully added new author: "
-								  << patterns::serial::pretty_print{(*(*pair.first)())} << logger::endl;
+								  << patterns::serial::pretty_print{(*added())} << logger::endl;
+				}
 				if(current_publication())
-					(*(*pair.first)())().publictions()()->insert(current_publication().data());
+					(*(*this->persons)[id]())().publictions()()->insert(current_publication().data());
 			}
 
 			return true;
@@ -69,9 +131,7 @@ namespace core
 		bool persons_extractor_t::visit(json_repr_t* ptr)
 		{
 			check_nullptr{ptr};
-			shared_person_t result;
-			auto& person = result().data();
-			person_t& pp{*person};
+			person_t pp{};
 
 			if(ptr->orcid.empty()
 				|| !objects::detail::detail_orcid_t::is_valid_orcid_string(ptr->orcid))
@@ -81,10 +141,10 @@ namespace core
 
 			if(!pp().orcid()().is_valid_orcid()) return false;
 
-			auto found = persons->find(person);
-			dassert(found != persons->end(), "unknown person for given orcid!"_u8);
+			const auto id = persons->find(pp);
+			dassert(id != persons_registry_t::npos, "unknown person for given orcid!"_u8);
 
-			(*(*found)())().publictions()()->insert(current_publication());
+			(*(*persons)[id]())().publictions()()->insert(current_publication());
 			return true;
 		}
 
@@ -92,7 +152,7 @@ namespace core
 		{
 			check_nullptr{ptr};
 
-			shared_publication_t spub{new publication_t{}};
+			shared_publication_t spub{std::make_shared<publication_t>()};
 			publication_t& pub = *spub();
 			person_visitor.current_publication().data().reset();
 
@@ -109,29 +169,30 @@ namespace core
 
 			if(ptr->year.empty()) return false;
 			else
-				pub().year(std::stoi(get_conversion_engine().to_bytes(ptr->year)));
+				pub().year(std::stoi(transcoding::to_utf8(ptr->year)));
 
 			if(ptr->org_title.empty() && ptr->whole_title.empty()) return false;
+
+			u16str_v title{};
+			u16str_v polish_title{};
+			if(ptr->org_title.empty()) title = ptr->whole_title;
+			else if(ptr->whole_title.empty())
+				title = ptr->org_title;
 			else
 			{
-				if(ptr->org_title.empty()) pub().title(ptr->whole_title);
-				else if(ptr->whole_title.empty())
-					pub().title(ptr->org_title);
+				if(demangler<>::is_polish(ptr->org_title)) polish_title = ptr->org_title;
 				else
-				{
-					if(demangler<>::is_polish(ptr->org_title)) pub().polish_title(ptr->org_title);
-					else
-						pub().title(ptr->org_title);
-
-					if(pub().polish_title()()->empty() && demangler<>::is_polish(ptr->whole_title))
-						pub().polish_title(ptr->whole_title);
-					else if(pub().title()()->empty())
-						pub().title(ptr->whole_title);
-				}
+					title = ptr->org_title;
+
+				if(polish_title.empty() && demangler<>::is_polish(ptr->whole_title))
+					polish_title = ptr->whole_title;
+				else if(title.empty())
+					title = ptr->whole_title;
 			}
 
-			demangler<>::sanitize(pub().title()().data());
-			demangler<>::sanitize(pub().polish_title()().data());
+			set_sanitized(pub().title()(), title);
+			set_sanitized(pub().polish_title()(), polish_title);
+			pub().update_fingerprint();
 
 			publications.push_back(spub);
 			person_visitor.current_publication = spub;
@@ -144,7 +205,7 @@ namespace core
 		{
 			check_nullptr{ptr};
 
-			shared_publication_t spub{new publication_t{}};
+			shared_publication_t spub{std::make_shared<publication_t>()};
 			publication_t& pub = *spub();
 			person_visitor.current_publication().data().reset();
 
@@ -154,35 +215,32 @@ namespace core
 				return false;
 			}
 			else
-				pub().year(std::stoi(get_conversion_engine().to_bytes(ptr->year)));
+				pub().year(std::stoi(transcoding::to_utf8(ptr->year)));
 
 			if(ptr->title.empty())
 			{
 				log.warn() << "failed validation because of empty title" << logger::endl;
 				return false;
 			}
-			else
-				pub().title(ptr->title);
 
-			if(!ptr->translated_title.empty())
-			{
-				pub().polish_title(ptr->translated_title);
-				if(demangler<>::is_polish(pub().title()())
-					&& !demangler<>::is_polish(pub().polish_title()().data()))
-					std::swap(pub().title(), pub().polish_title());
-
-				demangler<>::sanitize(pub().polish_title()().data());
-			}
+			using title_holder_t = std::remove_cvref_t<decltype(pub().title()())>;
+			u16str_v title{ptr->title};
+			u16str_v polish_title{ptr->translated_title};
+			if(!polish_title.empty()
+				&& demangler<>::is_polish(title_holder_t::unified(title))
+				&& !demangler<>::is_polish(title_holder_t::unified(polish_title)))
+				std::swap(title, polish_title);
 
-			demangler<>::sanitize(pub().title()().data());
+			set_sanitized(pub().title()(), title);
+			set_sanitized(pub().polish_title()(), polish_title);
+			pub().update_fingerprint();
 
 			for(const auto& pair: ptr->ids)
 			{
 				const objects::id_type id = objects::detail::id_type_stringinizer::get(pair.first);
 
 				if(id == objects::id_type::NOT_FOUND) continue;
-				auto exists_pair = pub().ids()()->find(id);
-				if(exists_pair == pub().ids()()->end()) pub().ids()().data()[id] = pair.second;
+				if(!pub().ids()()->contains(id)) pub().ids()().data()[id] = pair.second;
 			}
 
 			if(pub().ids()()->empty())
@@ -206,12 +264,12 @@ namespace core
 		{
 			for(const auto& person: *input.persons)
 			{
-				shared_person_t np{new person_t{}};
+				shared_person_t np{std::make_shared<person_t>()};
 				(*np())().name		= (*person())().name;
 				(*np())().surname = (*person())().surname;
 				(*np())().orcid	= (*person())().orcid;
-				auto pair			= output.persons->insert(np().data());
-				if(pair.second) (*(*pair.first)())().publictions()()->clear();
+				auto pair			= output.persons->insert(np);
+				if(pair.second) (*(*output.persons)[pair.first]())().publictions()()->clear();
 			}
 		}
 	}	 // namespace orm
@@ -0,0 +1,72 @@
+#include <antybiurokrata/libraries/objects/string_pool.h>
+
+// STL
+#include <mutex>
+
+namespace core
+{
+	namespace objects
+	{
+		namespace detail
+		{
+			const string_pool_t::entry_t* string_pool_t::intern(const u16str_v& value)
+			{
+				if(value.empty()) return empty();
+
+				{
+					std::shared_lock<std::shared_mutex> lck{m_mtx};
+					const auto found = m_index.find(value);
+					if(found != m_index.end())
+					{
+						add_reference(found->second.get());
+						return found->second.get();
+					}
+				}
+
+				std::unique_lock<std::shared_mutex> lck{m_mtx};
+
+				// someone could add it, between releasing shared lock and acquiring unique one
+				const auto found = m_index.find(value);
+				if(found != m_index.end())
+				{
+					add_reference(found->second.get());
+					return found->second.get();
+				}
+
+				std::unique_ptr<entry_t> added{new entry_t{u16str{value}, 1ul}};
+				const u16str_v key{added->value};
+				return m_index.emplace(key, std::move(added)).first->second.get();
+			}
+
+			void string_pool_t::release(const entry_t* entry) noexcept
+			{
+				if(entry == empty()) return;
+
+				// dropping not the last reference does not change pool
+				size_t references = entry->references.load(std::memory_order_relaxed);
+				while(references > 1ul)
+					if(entry->references.compare_exchange_weak(references, references - 1ul,
+																			 std::memory_order_acq_rel))
+						return;
+
+				// the last one is dropped under lock, so `intern` cannot find this entry meanwhile
+				std::unique_lock<std::shared_mutex> lck{m_mtx};
+				if(entry->references.fetch_sub(1ul, std::memory_order_acq_rel) == 1ul)
+					m_index.erase(m_index.find(u16str_v{entry->value}));
+			}
+
+			size_t string_pool_t::size() const
+			{
+				std::shared_lock<std::shared_mutex> lck{m_mtx};
+				return m_index.size();
+			}
+
+			string_pool_t& string_pool_t::global()
+			{
+				// never destroyed, so strings from static objects can be released at exit
+				static string_pool_t* const pool{new string_pool_t{}};
+				return *pool;
+			}
+		}	 // namespace detail
+	}		 // namespace objects
+}	 // namespace core
@@ -0,0 +1,398 @@
+/**
+ * @file binary_serializer.hpp
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains compact binary backend for serializable classes
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+/**
+ * @example "binary serialization ~ usage"
+ * for `Example` class from "serialization ~ usage":
+ * ```
+ * int main()
+ * {
+ * 	Example ex{10, 20, 30};
+ *
+ * 	std::ofstream ofile("myfile.bin", std::ios::binary);
+ * 	ofile << serialize_binary{ex}; // in file: 0A000000 14000000 1E000000
+ * 	ofile.close();
+ *
+ * 	std::ifstream ifile("myfile.bin", std::ios::binary);
+ * 	ifile >> deserialize_binary{ex};
+ * 	ifile.close();
+ *
+ * 	std::cout << pretty_print{ex}; // prints: _Example[ 10, 20, 30 ]
+ * 	return 0;
+ * }
+ * ```*/
+#pragma once
+
+#include <antybiurokrata/libraries/patterns/seiralizer.hpp>
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+namespace patterns
+{
+	namespace serial
+	{
+		/**
+		 * @brief binary backend for `cser` classes; integers are stored as fixed width little endian
+		 * numbers, strings and collections are prefixed with their length, there are no delimiters
+		 *
+		 * @remark `custom_serialize` and `custom_deserialize` describe text form only and are not used
+		 * here; to support new type specialize `binary::io`
+		 */
+		namespace binary
+		{
+			/** @brief type used to store lengths of strings and collections */
+			using size_type = uint32_t;
+
+			/** @brief longest string or collection accepted from stream, longer means corrupted data */
+			constexpr size_t max_length = size_t{1} << 24;
+
+			/**
+			 * @brief memory is allocated up front for so many elements at most, rest grows with read
+			 * data, so wrong length fails on end of stream, before it is allocated
+			 */
+			constexpr size_t max_preallocated = 4096ul;
+
+			/**
+			 * @brief reads and writes given type; specialize this struct for types that are not covered
+			 *
+			 * @tparam T any type
+			 */
+			template<typename T> struct io;
+
+			/**
+			 * @brief puts raw bytes of arithmetic value in little endian order
+			 *
+			 * @tparam T arithmetic type
+			 * @param os output stream
+			 * @param value value to write
+			 */
+			template<typename T> inline void write_raw(std::ostream& os, const T value)
+			{
+				auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+				if constexpr(std::endian::native == std::endian::big)
+					std::reverse(bytes.begin(), bytes.end());
+				os.write(bytes.data(), bytes.size());
+			}
+
+			/**
+			 * @brief reads raw bytes of arithmetic value in little endian order
+			 *
+			 * @tparam T arithmetic type
+			 * @param is input stream
+			 * @return T read value
+			 * @throw std::runtime_error if stream ended too early
+			 */
+			template<typename T> inline T read_raw(std::istream& is)
+			{
+				std::array<char, sizeof(T)> bytes;
+				if(!is.read(bytes.data(), bytes.size()))
+					throw std::runtime_error{"unexpected end of binary stream"};
+				if constexpr(std::endian::native == std::endian::big)
+					std::reverse(bytes.begin(), bytes.end());
+				return std::bit_cast<T>(bytes);
+			}
+
+			/** @brief writes length of string or collection */
+			inline void write_size(std::ostream& os, const size_t size)
+			{
+				if(size > std::numeric_limits<size_type>::max())
+					throw std::length_error{"collection too big for binary serialization"};
+				write_raw<size_type>(os, static_cast<size_type>(size));
+			}
+
+			/**
+			 * @brief reads length of string or collection
+			 *
+			 * @throw std::runtime_error if length is greater than `max_length`
+			 */
+			inline size_t read_size(std::istream& is)
+			{
+				const size_t size = read_raw<size_type>(is);
+				if(size > max_length) throw std::runtime_error{"invalid length in binary stream"};
+				return size;
+			}
+
+			/**
+			 * @brief helper to quickly pick proper `io` specialization
+			 *
+			 * @tparam T deduced
+			 */
+			template<typename T> inline void put(std::ostream& os, const T& value)
+			{
+				io<T>::put(os, value);
+			}
+
+			/**
+			 * @brief helper to quickly pick proper `io` specialization
+			 *
+			 * @tparam T deduced
+			 */
+			template<typename T> inline void get(std::istream& is, T& value) { io<T>::get(is, value); }
+
+			/** @brief This class is used by ser to binary serialize class members */
+			struct put_to_stream
+			{
+				template<typename Any> put_to_stream(std::ostream& os, const Any& any) { put(os, any); }
+			};
+
+			/** @brief This class is used by ser to binary deserialize class members */
+			struct get_from_stream
+			{
+				template<typename Any> get_from_stream(std::istream& is, Any& any) { get(is, any); }
+			};
+
+			/** @brief arithmetic types and enums are stored with fixed width */
+			template<typename T>
+			requires(std::is_arithmetic_v<T> || std::is_enum_v<T>) struct io<T>
+			{
+				using raw_t = typename std::conditional_t<
+					 std::is_enum_v<T>, std::underlying_type<T>,
+					 std::conditional<std::is_same_v<T, bool>, uint8_t, T>>::type;
+
+				static void put(std::ostream& os, const T& value)
+				{
+					write_raw<raw_t>(os, static_cast<raw_t>(value));
+				}
+
+				static void get(std::istream& is, T& value)
+				{
+					value = static_cast<T>(read_raw<raw_t>(is));
+				}
+			};
+
+			/** @brief strings are stored as length and raw characters */
+			template<typename char_t, typename traits_t, typename alloc_t>
+			struct io<std::basic_string<char_t, traits_t, alloc_t>>
+			{
+				using string_t = std::basic_string<char_t, traits_t, alloc_t>;
+
+				static void put(std::ostream& os, const string_t& value)
+				{
+					write_size(os, value.size());
+					if constexpr(sizeof(char_t) == 1 || std::endian::native == std::endian::little)
+						os.write(reinterpret_cast<const char*>(value.data()),
+									value.size() * sizeof(char_t));
+					else
+						for(const char_t c: value) write_raw(os, c);
+				}
+
+				static void get(std::istream& is, string_t& value)
+				{
+					const size_t size = read_size(is);
+					value.clear();
+					if constexpr(sizeof(char_t) == 1 || std::endian::native == std::endian::little)
+						for(size_t done = 0; done < size;)
+						{
+							const size_t part = std::min(size - done, max_preallocated);
+							value.resize(done + part);
+							char* output = reinterpret_cast<char*>(value.data() + done);
+							if(!is.read(output, part * sizeof(char_t)))
+								throw std::runtime_error{"unexpected end of binary stream"};
+							done += part;
+						}
+					else
+					{
+						value.reserve(std::min(size, max_preallocated));
+						for(size_t i = 0; i < size; ++i) value.push_back(read_raw<char_t>(is));
+					}
+				}
+			};
+
+			/** @brief fixed size arrays are stored without length */
+			template<typename T, size_t N> struct io<std::array<T, N>>
+			{
+				static void put(std::ostream& os, const std::array<T, N>& value)
+				{
+					for(const auto& x: value) binary::put(os, x);
+				}
+
+				static void get(std::istream& is, std::array<T, N>& value)
+				{
+					for(auto& x: value) binary::get(is, x);
+				}
+			};
+
+			/** @brief pairs are stored as two following values */
+			template<typename T, typename U> struct io<std::pair<T, U>>
+			{
+				static void put(std::ostream& os, const std::pair<T, U>& value)
+				{
+					binary::put(os, value.first);
+					binary::put(os, value.second);
+				}
+
+				static void get(std::istream& is, std::pair<T, U>& value)
+				{
+					binary::get(is, value.first);
+					binary::get(is, value.second);
+				}
+			};
+
+			/** @brief shared pointers are stored as null flag and optionally value */
+			template<typename T> struct io<std::shared_ptr<T>>
+			{
+				static void put(std::ostream& os, const std::shared_ptr<T>& value)
+				{
+					write_raw<uint8_t>(os, static_cast<uint8_t>(value.get() == nullptr));
+					if(value) binary::put(os, *value);
+				}
+
+				static void get(std::istream& is, std::shared_ptr<T>& value)
+				{
+					const bool is_null = read_raw<uint8_t>(is) != 0;
+					value.reset();
+					if(is_null) return;
+					value = std::make_shared<T>();
+					binary::get(is, *value);
+				}
+			};
+
+			/**
+			 * @brief defines requirements for collections, that can be written as length and elements
+			 *
+			 * @tparam coll_t type to check
+			 */
+			template<typename coll_t> concept collection_req = requires(coll_t c)
+			{
+				typename coll_t::value_type;
+				{c.begin()};
+				{c.end()};
+				{c.clear()};
+				{
+					c.size()
+				}
+				->std::convertible_to<size_t>;
+			};
+
+			/** @brief defines additional requirements for vector-like collections */
+			template<typename coll_t>
+			concept sequence_req = collection_req<coll_t>&& requires(coll_t c)
+			{
+				{c.reserve(size_t{})};
+				{c.emplace_back()};
+			};
+
+			/** @brief defines additional requirements for map-like collections */
+			template<typename coll_t> concept associative_req = collection_req<coll_t>&& requires
+			{
+				typename coll_t::key_type;
+				typename coll_t::mapped_type;
+			};
+
+			/** @brief checks is given type a string, because strings are also collections */
+			template<typename T> constexpr bool is_string_v = false;
+			template<typename char_t, typename traits_t, typename alloc_t>
+			constexpr bool is_string_v<std::basic_string<char_t, traits_t, alloc_t>> = true;
+
+			/** @brief collections are stored as length and following elements */
+			template<typename coll_t>
+			requires(collection_req<coll_t> && !is_string_v<coll_t>) struct io<coll_t>
+			{
+				static void put(std::ostream& os, const coll_t& value)
+				{
+					write_size(os, value.size());
+					for(const auto& x: value)
+					{
+						if constexpr(associative_req<coll_t>)
+						{
+							binary::put(os, x.first);
+							binary::put(os, x.second);
+						}
+						else
+							binary::put(os, x);
+					}
+				}
+
+				static void get(std::istream& is, coll_t& value)
+				{
+					const size_t size = read_size(is);
+					value.clear();
+					if constexpr(sequence_req<coll_t>)
+					{
+						value.reserve(std::min(size, max_preallocated));
+						for(size_t i = 0; i < size; ++i) binary::get(is, value.emplace_back());
+					}
+					else if constexpr(associative_req<coll_t>)
+						for(size_t i = 0; i < size; ++i)
+						{
+							typename coll_t::key_type key{};
+							typename coll_t::mapped_type mapped{};
+							binary::get(is, key);
+							binary::get(is, mapped);
+							value.emplace_hint(value.end(), std::move(key), std::move(mapped));
+						}
+					else
+						for(size_t i = 0; i < size; ++i)
+						{
+							typename coll_t::value_type x{};
+							binary::get(is, x);
+							value.emplace_hint(value.end(), std::move(x));
+						}
+				}
+			};
+
+			/** @brief serializable classes are stored as their members, in order of declaration */
+			template<auto X> struct io<cser<X>>
+			{
+				static void put(std::ostream& os, const cser<X>& value)
+				{
+					stream_handler<std::ostream, put_to_stream> vs{os};
+					value.accept(&vs);
+				}
+
+				static void get(std::istream& is, cser<X>& value)
+				{
+					stream_handler<std::istream, get_from_stream> vs{is};
+					value.accept(&vs);
+				}
+			};
+		}	 // namespace binary
+
+		/**
+		 * @brief binary serialization marker in stream
+		 *
+		 * @tparam X any type supported by `binary::io`
+		 */
+		template<typename X> struct serialize_binary
+		{
+			const X& x;
+		};
+
+		/**
+		 * @brief binary deserialization marker in stream
+		 *
+		 * @tparam X any type supported by `binary::io`
+		 */
+		template<typename X> struct deserialize_binary
+		{
+			X& x;
+		};
+
+		template<typename X>
+		inline std::ostream& operator<<(std::ostream& os, const serialize_binary<X>& obj)
+		{
+			binary::put(os, obj.x);
+			return os;
+		}
+
+		template<typename X>
+		inline std::istream& operator>>(std::istream& is, const deserialize_binary<X>& obj)
+		{
+			binary::get(is, obj.x);
+			return is;
+		}
+	}	 // namespace serial
+}	 // namespace patterns
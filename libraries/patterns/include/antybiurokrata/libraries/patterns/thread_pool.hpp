@@ -0,0 +1,123 @@
+/**
+ * @file thread_pool.hpp
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains definition of simple pool of worker threads
+ * 
+ * @copyright Copyright (c) 2021
+ * 
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace patterns
+{
+	/**
+	 * @brief fixed amount of threads, that executes queued tasks
+	 * 
+	 * @remark can be safely used by many threads at once, as long as they are not workers of this pool
+	 */
+	class thread_pool
+	{
+		using task_t = std::function<void()>;
+
+		std::mutex m_mtx;
+		std::condition_variable_any m_cv;
+		std::deque<task_t> m_tasks;
+		std::vector<std::jthread> m_workers;
+
+	 public:
+		/**
+		 * @brief Construct a new thread pool object
+		 * 
+		 * @param threads amount of workers, by default one per core
+		 */
+		explicit thread_pool(const size_t threads = default_size())
+		{
+			m_workers.reserve(threads);
+			for(size_t i = 0; i < threads; ++i)
+				m_workers.emplace_back([this](std::stop_token token) { work(token); });
+		}
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		/** @brief stops all workers, tasks that are not started are dropped */
+		~thread_pool()
+		{
+			for(auto& worker: m_workers) worker.request_stop();
+			m_cv.notify_all();
+		}
+
+		/** @brief amount of workers */
+		size_t size() const noexcept { return m_workers.size(); }
+
+		/** @brief amount of threads, that can run in parallel on this machine */
+		static size_t default_size() noexcept
+		{
+			return std::max<size_t>(std::thread::hardware_concurrency(), 1ul);
+		}
+
+		/**
+		 * @brief calls `fun(i)` for every `i` in [0; count) on workers and waits for all of them
+		 * 
+		 * @tparam functor_t callable with size_t
+		 * @param count amount of calls
+		 * @param fun function to call
+		 * 
+		 * @throw first exception thrown by `fun`, after all calls are finished
+		 */
+		template<typename functor_t> void parallel_for(const size_t count, functor_t&& fun)
+		{
+			if(count == 0ul) return;
+			std::latch done{static_cast<std::ptrdiff_t>(count)};
+			std::mutex error_mtx;
+			std::exception_ptr error{nullptr};
+			{
+				std::unique_lock<std::mutex> lck{m_mtx};
+				for(size_t i = 0; i < count; ++i)
+					m_tasks.emplace_back([&fun, &done, &error_mtx, &error, i]() {
+						try
+						{
+							fun(i);
+						}
+						catch(...)
+						{
+							std::unique_lock<std::mutex> lck{error_mtx};
+							if(!error) error = std::current_exception();
+						}
+						done.count_down();
+					});
+			}
+			m_cv.notify_all();
+			done.wait();
+			if(error) std::rethrow_exception(error);
+		}
+
+	 private:
+		/** @brief loop of every worker */
+		void work(const std::stop_token& token)
+		{
+			while(true)
+			{
+				task_t task;
+				{
+					std::unique_lock<std::mutex> lck{m_mtx};
+					if(!m_cv.wait(lck, token, [this] { return !m_tasks.empty(); })) return;
+					task = std::move(m_tasks.front());
+					m_tasks.pop_front();
+				}
+				task();
+			}
+		}
+	};
+}	 // namespace patterns
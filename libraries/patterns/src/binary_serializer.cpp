@@ -0,0 +1 @@
+#include <antybiurokrata/libraries/patterns/binary_serializer.hpp>
\ No newline at end of file
@@ -0,0 +1 @@
+#include <antybiurokrata/libraries/patterns/thread_pool.hpp>
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file fuzzy_matcher.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief contains declaration of bit-parallel Damerau–Levenshtein distance
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#pragma once
+
+// STL
+#include <vector>
+
+// Project includes
+#include <antybiurokrata/types.hpp>
+
+namespace core
+{
+	namespace reports
+	{
+		/** @brief contains approximate string matching */
+		namespace fuzzy
+		{
+			using word_t = uint64_t;
+
+			/**
+			 * @brief precomputed bit masks of every character in pattern, so one pattern can be
+			 * compared with many texts. Bit `i` of word `w` is set, if `pattern[w * 64 + i] == c`
+			 */
+			class pattern_t
+			{
+			 public:
+				constexpr static size_t word_bits	  = sizeof(word_t) * 8ul;
+				constexpr static size_t ascii_chars = 128ul;
+
+				/**
+				 * @brief Construct a new pattern object
+				 *
+				 * @param pattern sanitized string
+				 */
+				explicit pattern_t(const u16str_v& pattern);
+
+				/** @brief length of pattern */
+				size_t size() const noexcept { return m_size; }
+
+				/** @brief amount of machine words required for one column */
+				size_t words() const noexcept { return m_words; }
+
+				/**
+				 * @brief returns bit mask of occurences of character in given part of pattern
+				 *
+				 * @param word index of word
+				 * @param c character to look for
+				 * @return word_t
+				 */
+				word_t get(const size_t word, const u16char_t c) const noexcept
+				{
+					if(c < ascii_chars) return m_ascii[word * ascii_chars + c];
+					for(const auto& ext: m_extended)
+						if(ext.first == c) return ext.second[word];
+					return 0ul;
+				}
+
+			 private:
+				size_t m_size;
+				size_t m_words;
+				std::vector<word_t> m_ascii;
+				std::vector<std::pair<u16char_t, std::vector<word_t>>> m_extended;
+			};
+
+			/**
+			 * @brief computes optimal string alignment distance (Damerau–Levenshtein with adjacent
+			 * transpositions) with Hyyrö's bit-parallel algorithm, 64 cells of DP matrix are computed at once
+			 *
+			 * @param pattern precomputed pattern
+			 * @param text string to compare with pattern
+			 * @param max if distance for sure exceeds this value computations are stopped
+			 * @return size_t distance, or `max + 1` if it is greater than `max`
+			 */
+			size_t distance(const pattern_t& pattern, const u16str_v& text, const size_t max);
+
+			/**
+			 * @brief proxy to `distance`, without limit
+			 *
+			 * @param lhs first string
+			 * @param rhs second string
+			 * @return size_t optimal string alignment distance
+			 */
+			size_t distance(const u16str_v& lhs, const u16str_v& rhs);
+
+			/**
+			 * @brief maximal distance, that still means that both strings are similar
+			 *
+			 * @param lhs_length length of first string
+			 * @param rhs_length length of second string
+			 * @param ratio maximal distance relative to longer string, in range [0; 1)
+			 * @return size_t limit of distance
+			 */
+			inline size_t max_distance(const size_t lhs_length, const size_t rhs_length,
+												const double ratio) noexcept
+			{
+				const size_t longer = std::max(lhs_length, rhs_length);
+				return static_cast<size_t>(static_cast<double>(longer) * ratio);
+			}
+		}	 // namespace fuzzy
+	}		 // namespace reports
+}	 // namespace core
@@ -11,12 +11,20 @@
 #pragma once
 
 // STL
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <stop_token>
+#include <unordered_map>
 
 // Project Includes
 #include <antybiurokrata/libraries/patterns/observer.hpp>
 #include <antybiurokrata/libraries/patterns/safe.hpp>
+#include <antybiurokrata/libraries/patterns/thread_pool.hpp>
 #include <antybiurokrata/libraries/orm/orm.h>
+#include <antybiurokrata/libraries/fuzzy_matcher/fuzzy_matcher.h>
 
 namespace core
 {
@@ -27,6 +35,261 @@ namespace core
 		using report_collection_t = std::vector<report_item_t>;
 		using report_t				  = std::shared_ptr<report_collection_t>;
 
+		/** @brief contains internal helpers of summary */
+		namespace detail
+		{
+			/**
+			 * @brief hash-based index over reference publications, built once in `summary::activate`
+			 * 
+			 * @remark lookup returns only candidates, final decision still belongs to `detail_publication_t::compare`
+			 */
+			class publication_index_t
+			{
+			 public:
+				using position_t	= size_t;
+				using positions_t = std::vector<position_t>;
+
+				/**
+				 * @brief fills index with publications from given part of report
+				 * 
+				 * @param reference report items, positions in index refers to this collection
+				 * @param begin first indexed position
+				 * @param end position after last indexed one
+				 */
+				void build(const report_collection_t& reference, const position_t begin,
+							  const position_t end);
+
+				/**
+				 * @brief collects positions of reference publications, that can be equal to given one
+				 * 
+				 * @param pub publication to look for
+				 * @param output [out] sorted and unique positions of candidates
+				 */
+				void lookup(const objects::publication_t& pub, positions_t& output) const;
+
+				/**
+				 * @brief adds one publication to already built index
+				 * 
+				 * @param pub publication to add
+				 * @param pos position of publication
+				 */
+				void insert(const objects::publication_t& pub, const position_t pos);
+
+				/**
+				 * @brief collects positions of reference publications from the same year, which titles
+				 * have length that allows them to be similar to title of given one
+				 * 
+				 * @param pub publication to look for
+				 * @param ratio maximal distance between titles, relative to longer title
+				 * @param output [out] positions of candidates
+				 */
+				void lookup_similar(const objects::publication_t& pub, const double ratio,
+										  positions_t& output) const;
+
+			 private:
+				/** @brief adds publication to maps, that are not sorted */
+				void add_keys(const objects::publication_t& pub, const position_t pos);
+
+				/** @brief primary key: type of id and its unified, interned value */
+				struct id_key_t
+				{
+					objects::id_type type;
+					objects::detail::interned_u16str_t value;
+
+					inline friend bool operator==(const id_key_t&, const id_key_t&) = default;
+				};
+
+				/** @brief secondary key: year and sanitized, interned title */
+				struct title_key_t
+				{
+					uint16_t year;
+					objects::detail::interned_u16str_t title;
+
+					inline friend bool operator==(const title_key_t&, const title_key_t&) = default;
+				};
+
+				/** @brief hashes both types of keys, by handles of interned strings */
+				struct key_hash_t
+				{
+					size_t operator()(const id_key_t& key) const noexcept;
+					size_t operator()(const title_key_t& key) const noexcept;
+				};
+
+				std::unordered_map<id_key_t, positions_t, key_hash_t> m_by_id;
+				std::unordered_map<title_key_t, positions_t, key_hash_t> m_by_title;
+
+				/** @brief pairs of title length and position, sorted by length, grouped by year */
+				std::unordered_map<uint16_t, std::vector<std::pair<size_t, position_t>>> m_by_year;
+			};
+
+			/**
+			 * @brief structure of arrays with everything that matching needs from reference
+			 * publications of one shard, so workers scan contiguous memory instead of following
+			 * pointers to report items, publications and maps of ids
+			 * 
+			 * @remark built once in `summary::activate`, positions are the same as in report
+			 */
+			class publication_columns_t
+			{
+			 public:
+				using position_t = publication_index_t::position_t;
+
+				constexpr static size_t id_types = objects::detail::id_type_translation_unit::length;
+
+				/** @brief handles of interned ids, indexed by `id_type`, nullptr if id is missing */
+				using id_handles_t = std::array<const u16str*, id_types>;
+
+				/** @brief bit `1 << id_type` is set for every present id */
+				using id_mask_t = objects::detail::detail_ids_storage_t::inner_t::mask_t;
+
+				/** @brief the same data for single publication, e.g. from input */
+				struct row_t
+				{
+					objects::detail::title_fingerprint_t fingerprint;
+					const u16str* polish_title;
+					id_mask_t id_mask;
+					id_handles_t ids;
+
+					/** @brief extracts columns from given publication */
+					static row_t make(const objects::publication_t& pub);
+				};
+
+				/**
+				 * @brief fills columns with publications from given part of report
+				 * 
+				 * @param reference report items
+				 * @param begin first stored position
+				 * @param end position after last stored one
+				 */
+				void build(const report_collection_t& reference, const position_t begin,
+							  const position_t end);
+
+				/**
+				 * @brief checks are publication at given position and given one equal
+				 * 
+				 * @remark gives the same result as `detail_publication_t::compare(...) == 0`: common type
+				 * of id decides, otherwise year, title and polish title (if both have it) have to be equal
+				 * 
+				 * @param pos position in report
+				 * @param row columns of other publication
+				 * @return true if equal
+				 */
+				bool equal(const position_t pos, const row_t& row) const noexcept;
+
+				/** @brief checks has publication at given position and given one any common type of id */
+				bool have_common_ids(const position_t pos, const row_t& row) const noexcept;
+
+				/** @brief sanitized title of publication at given position */
+				u16str_v title(const position_t pos) const noexcept
+				{
+					const size_t i = pos - m_begin;
+					return u16str_v{m_text.data() + m_offsets[i], m_offsets[i + 1ul] - m_offsets[i]};
+				}
+
+			 private:
+				position_t m_begin{0ul};
+
+				std::vector<objects::detail::title_fingerprint_t> m_fingerprints;
+				std::vector<const u16str*> m_polish_titles;
+				std::vector<id_mask_t> m_id_masks;
+				std::vector<id_handles_t> m_ids;
+
+				/** @brief all titles one after another, title `i` is in [m_offsets[i]; m_offsets[i + 1]) */
+				u16str m_text;
+				std::vector<uint32_t> m_offsets;
+			};
+
+			/** @brief contiguous part of report, owned by one task of thread pool */
+			struct report_shard_t
+			{
+				using position_t = publication_index_t::position_t;
+
+				position_t begin;
+				position_t end;
+				publication_index_t index;
+				publication_columns_t columns;
+			};
+
+			/**
+			 * @brief matches of one data source, recorded without global lock
+			 * 
+			 * @remark every report item has slot with position of matched publication in `publications`,
+			 * the lowest position wins, so result does not depend on order of threads. Fuzzy matches are
+			 * marked with `fuzzy_flag`, so exact match from any later batch replaces them. Slots are moved
+			 * to report just before `on_done`
+			 */
+			class staged_matches_t
+			{
+			 public:
+				using position_t = publication_index_t::position_t;
+
+				/** @brief value of empty slot */
+				constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+				/** @brief marks values of slots, that comes from fuzzy matching */
+				constexpr static size_t fuzzy_flag = size_t{1}
+																 << (std::numeric_limits<size_t>::digits - 1);
+
+				/**
+				 * @brief clears all matches
+				 * 
+				 * @param report_size amount of report items
+				 */
+				void reset(const size_t report_size);
+
+				/**
+				 * @brief keeps given publications alive until materialization
+				 * 
+				 * @param input publications that will be referred by slots
+				 * @return size_t position of first given publication
+				 */
+				size_t retain(const std::vector<objects::shared_publication_t>& input);
+
+				/**
+				 * @brief lock-free records match, lower value of slot wins
+				 * 
+				 * @param pos position of report item
+				 * @param value position of publication, returned by `retain` increased by index in input,
+				 * optionally with `fuzzy_flag`
+				 */
+				void claim(const position_t pos, const size_t value) noexcept
+				{
+					std::atomic<size_t>& slot = m_slots[pos];
+					size_t current				  = slot.load(std::memory_order_relaxed);
+					while(value < current
+							&& !slot.compare_exchange_weak(current, value, std::memory_order_relaxed))
+						;
+				}
+
+				/** @brief checks is given report item already matched */
+				bool taken(const position_t pos) const noexcept
+				{
+					return m_slots[pos].load(std::memory_order_relaxed) != npos;
+				}
+
+				/**
+				 * @brief returns matched publication of given report item
+				 * 
+				 * @param pos position of report item
+				 * @return const objects::shared_publication_t* nullptr if not matched
+				 */
+				const objects::shared_publication_t* get(const position_t pos) const noexcept;
+
+			 private:
+				std::mutex m_mtx;
+				std::vector<objects::shared_publication_t> m_publications;
+				std::vector<std::atomic<size_t>> m_slots;
+			};
+		}	 // namespace detail
+
+		/**
+		 * @brief joins many reports into one, equal reference publications are stored once, with all matches
+		 * 
+		 * @param reports reports to join, nullptr are skipped
+		 * @return report_t new report, given reports are not modified
+		 */
+		report_t merge_reports(const std::vector<report_t>& reports);
+
 		/**
 		 * @brief matches given publications and produces summary
 		 */
@@ -38,12 +301,39 @@ namespace core
 
 			// using second_publications_t = std::optional<std::ref<shared_publication_t>>;
 
+			/** @brief minimal amount of report items in one shard */
+			constexpr static size_t min_shard_size = 256ul;
+			constexpr static size_t sources
+				 = objects::detail::match_type_translation_unit::length;
+
 			patterns::safe<report_t> m_report{report_t{new report_collection_t{}}};
+			std::vector<detail::report_shard_t> m_shards;
+			std::array<detail::staged_matches_t, sources> m_staged;
+			std::shared_ptr<patterns::thread_pool> m_pool{new patterns::thread_pool{}};
 			std::atomic<bool> is_ready{false};
+			std::atomic<bool> is_aborted{false};
+			std::atomic<double> m_fuzzy_ratio{default_fuzzy_ratio};
+
+			/** @brief `process` waits here, until summary is activated or aborted */
+			std::mutex m_ready_mtx;
+			std::condition_variable_any m_ready_cv;
 
 		 public:
+			/** @brief by default titles can differ on 10% of characters */
+			constexpr static double default_fuzzy_ratio = 0.1;
+
 			bool ready() const volatile { return is_ready.load(); }
 
+			/**
+			 * @brief sets threshold of fuzzy matching, used for publications that has no exact match
+			 * 
+			 * @param ratio maximal Damerau–Levenshtein distance between titles, relative to longer one, 0 disables fuzzy matching
+			 */
+			void fuzzy_ratio(const double ratio) { m_fuzzy_ratio.store(std::clamp(ratio, 0.0, 0.5)); }
+
+			/** @brief returns current threshold of fuzzy matching */
+			double fuzzy_ratio() const { return m_fuzzy_ratio.load(); }
+
 			/**
 			 * @brief Construct a new summary object, proxy to activate
 			 * 
@@ -52,6 +342,13 @@ namespace core
 			explicit summary(publications_storage_t reference);
 			explicit summary() = default;
 
+			/**
+			 * @brief Construct a new summary object, that uses shared workers
+			 * 
+			 * @param pool pool of threads, that processes shards
+			 */
+			explicit summary(std::shared_ptr<patterns::thread_pool> pool);
+
 			/**
 			 * @brief Initializes all members
 			 * 
@@ -59,13 +356,28 @@ namespace core
 			 */
 			void activate(publications_storage_t reference);
 
+			/**
+			 * @brief marks, that reference data will never come, so all waiting `process` calls fails
+			 * 
+			 * @remark has no effect on already activated summary
+			 */
+			void abort();
+
 			/**
 			 * @brief appends comprasion output to internal storage, can take a while
 			 * 
+			 * @remark can be called many times for one source with following parts of input (streaming),
+			 * earlier publications wins, but exact match always replaces fuzzy one. If summary is not
+			 * activated yet, waits for `activate` or `abort`
+			 * 
 			 * @param input data to compare
 			 * @param mt data source
+			 * @param stop_token stops waiting for activation
+			 * 
+			 * @exception core::exceptions::assert_exception if summary is aborted or stop is requested before activation
 			 */
-			void process(publications_storage_t input, const objects::match_type mt);
+			void process(publications_storage_t input, const objects::match_type mt,
+							 const std::stop_token& stop_token = {});
 
 			/**
 			 * @brief called in destructor, provides pointer to return
@@ -74,6 +386,8 @@ namespace core
 
 			/**
 			 * @brief Destroy the summary object and constructs report
+			 * 
+			 * @remark if report cannot be constructed, error is logged and `on_done` is not called
 			 */
 			~summary();
 
@@ -83,8 +397,47 @@ namespace core
 			 * 
 			 * @param input data
 			 * @param mt data source
+			 * @param stop_token stops waiting for activation
+			 */
+			void process_impl(publications_storage_t input, const objects::match_type mt,
+									const std::stop_token& stop_token);
+
+			/** @brief distance and position of the closest title found by fuzzy matching */
+			using fuzzy_candidate_t = std::pair<size_t, detail::staged_matches_t::position_t>;
+
+			/**
+			 * @brief finds exact matches in one shard
+			 * 
+			 * @param shard part of report to search in
+			 * @param input data
+			 * @param offset value returned by `staged_matches_t::retain` for input
+			 * @param mt data source
+			 * @param found [out] non zero for every input publication with exact equivalent in shard
+			 */
+			void match_exact(const detail::report_shard_t& shard, publications_storage_t input,
+								  const size_t offset, const objects::match_type mt,
+								  std::vector<uint8_t>& found);
+
+			/**
+			 * @brief finds the closest, similar enough titles from the same year for publications without exact equivalent
+			 * 
+			 * @param shard part of report to search in
+			 * @param input data
+			 * @param found non zero for every input publication, that has exact match
+			 * @param mt data source
+			 * @param best [out] the closest candidate for every input publication in this shard, with the
+			 * lowest position on equal distances
+			 */
+			void match_fuzzy(const detail::report_shard_t& shard, publications_storage_t input,
+								  const std::vector<uint8_t>& found, const objects::match_type mt,
+								  std::vector<fuzzy_candidate_t>& best);
+
+			/**
+			 * @brief moves all recorded matches into report
+			 * 
+			 * @param obj report
 			 */
-			void process_impl(publications_storage_t input, const objects::match_type mt);
+			void materialize(report_t& obj);
 
 			/**
 			 * @brief methode for multithreading
@@ -107,7 +460,10 @@ namespace core
 			 */
 			inline friend void invoke_on_done_helper(summary& that)
 			{
-				that.m_report.access([&](report_t& obj) { that.invoke_on_done(obj); });
+				that.m_report.access([&](report_t& obj) {
+					that.materialize(obj);
+					that.invoke_on_done(obj);
+				});
 			}
 		};
 	}	 // namespace reports
@@ -0,0 +1,118 @@
+#include <antybiurokrata/libraries/fuzzy_matcher/fuzzy_matcher.h>
+
+// STL
+#include <algorithm>
+
+namespace core
+{
+	namespace reports
+	{
+		namespace fuzzy
+		{
+			pattern_t::pattern_t(const u16str_v& pattern)
+				 : m_size{pattern.size()}, m_words{(pattern.size() + word_bits - 1ul) / word_bits},
+					m_ascii(m_words * ascii_chars, 0ul)
+			{
+				for(size_t i = 0; i < pattern.size(); ++i)
+				{
+					const u16char_t c	 = pattern[i];
+					const size_t word	 = i / word_bits;
+					const word_t mask = word_t{1} << (i % word_bits);
+
+					if(c < ascii_chars)
+					{
+						m_ascii[word * ascii_chars + c] |= mask;
+						continue;
+					}
+
+					auto it = std::find_if(m_extended.begin(), m_extended.end(),
+												  [c](const auto& ext) { return ext.first == c; });
+					if(it == m_extended.end())
+						it = m_extended.emplace(m_extended.end(), c, std::vector<word_t>(m_words, 0ul));
+					it->second[word] |= mask;
+				}
+			}
+
+			size_t distance(const pattern_t& pattern, const u16str_v& text, const size_t max)
+			{
+				const size_t m = pattern.size();
+				const size_t n = text.size();
+				if(m == 0) return std::min(n, max + 1ul);
+				if(n == 0) return std::min(m, max + 1ul);
+				if((m > n ? m - n : n - m) > max) return max + 1ul;
+
+				/** @brief state of one word of column */
+				struct column_t
+				{
+					word_t vp = ~word_t{0};
+					word_t vn = 0ul;
+					word_t d0 = 0ul;
+					word_t pm = 0ul;
+				};
+
+				constexpr size_t top_bit = pattern_t::word_bits - 1ul;
+				const size_t words		 = pattern.words();
+				const word_t last			 = word_t{1} << ((m - 1ul) % pattern_t::word_bits);
+
+				// index 0 is a sentinel, so previous word of first one always exists
+				std::vector<column_t> previous(words + 1ul), current(words + 1ul);
+				previous[0] = current[0] = column_t{0ul, 0ul, ~word_t{0}, 0ul};
+				size_t dist = m;
+
+				for(size_t j = 0; j < n; ++j)
+				{
+					const u16char_t c = text[j];
+					word_t hp_carry	= 1ul;
+					word_t hn_carry	= 0ul;
+
+					for(size_t w = 0; w < words; ++w)
+					{
+						const column_t& prev = previous[w + 1ul];
+						const word_t pm		= pattern.get(w, c);
+
+						// adjacent transposition, crossing border of words
+						const word_t tr = (((~prev.d0 & pm) << 1ul)
+												 | ((~previous[w].d0 & current[w].pm) >> top_bit))
+												& prev.pm;
+						const word_t x	= pm | hn_carry;
+						const word_t d0 = (((x & prev.vp) + prev.vp) ^ prev.vp) | x | prev.vn | tr;
+
+						word_t hp = prev.vn | ~(d0 | prev.vp);
+						word_t hn = d0 & prev.vp;
+
+						if(w + 1ul == words)
+						{
+							dist += static_cast<bool>(hp & last);
+							dist -= static_cast<bool>(hn & last);
+						}
+
+						const word_t hp_out = hp >> top_bit;
+						const word_t hn_out = hn >> top_bit;
+						hp						  = (hp << 1ul) | hp_carry;
+						hn						  = (hn << 1ul) | hn_carry;
+						hp_carry				  = hp_out;
+						hn_carry				  = hn_out;
+
+						column_t& next = current[w + 1ul];
+						next.vp			= hn | ~(d0 | hp);
+						next.vn			= hp & d0;
+						next.d0			= d0;
+						next.pm			= pm;
+					}
+
+					// every next column can decrease distance at most by one
+					if(dist > max + (n - j - 1ul)) return max + 1ul;
+					std::swap(previous, current);
+				}
+
+				return std::min(dist, max + 1ul);
+			}
+
+			size_t distance(const u16str_v& lhs, const u16str_v& rhs)
+			{
+				const size_t max = std::max(lhs.size(), rhs.size());
+				return distance(pattern_t{lhs}, rhs, max);
+			}
+		}	 // namespace fuzzy
+	}		 // namespace reports
+}	 // namespace core
@@ -1,11 +1,253 @@
 #include <antybiurokrata/libraries/summary/summary.h>
 
+// STL
+#include <algorithm>
+#include <bit>
+
 namespace core
 {
 	namespace reports
 	{
+		namespace detail
+		{
+			size_t publication_index_t::key_hash_t::operator()(const id_key_t& key) const noexcept
+			{
+				const size_t seed = static_cast<size_t>(key.type);
+				return std::hash<const u16str*>{}(key.value.handle())
+						 ^ (seed + 0x9e3779b97f4a7c15ul + (seed << 6));
+			}
+
+			size_t publication_index_t::key_hash_t::operator()(const title_key_t& key) const noexcept
+			{
+				const size_t seed = static_cast<size_t>(key.year);
+				return std::hash<const u16str*>{}(key.title.handle())
+						 ^ (seed + 0x9e3779b97f4a7c15ul + (seed << 6));
+			}
+
+			void publication_index_t::build(const report_collection_t& reference,
+													  const position_t begin, const position_t end)
+			{
+				m_by_id.clear();
+				m_by_title.clear();
+				m_by_year.clear();
+				m_by_id.reserve((end - begin) * 2ul);
+				m_by_title.reserve(end - begin);
+
+				for(position_t pos = begin; pos < end; ++pos)
+				{
+					const objects::publication_t& ref = *(*reference[pos]())().reference()();
+					add_keys(ref, pos);
+					m_by_year[ref().year()].emplace_back(ref().title()()->size(), pos);
+				}
+
+				for(auto& pair: m_by_year) std::sort(pair.second.begin(), pair.second.end());
+			}
+
+			void publication_index_t::insert(const objects::publication_t& pub, const position_t pos)
+			{
+				add_keys(pub, pos);
+				auto& bucket = m_by_year[pub().year()];
+				const std::pair<size_t, position_t> item{pub().title()()->size(), pos};
+				bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), item), item);
+			}
+
+			void publication_index_t::add_keys(const objects::publication_t& pub, const position_t pos)
+			{
+				for(const auto& pair: pub().ids()().data())
+					m_by_id[id_key_t{pair.first, pair.second().data()}].push_back(pos);
+				m_by_title[title_key_t{pub().year(), pub().title()().data()}].push_back(pos);
+			}
+
+			void publication_index_t::lookup(const objects::publication_t& pub,
+														positions_t& output) const
+			{
+				output.clear();
+				const auto append = [&output](const positions_t& found) {
+					output.insert(output.end(), found.begin(), found.end());
+				};
+
+				for(const auto& pair: pub().ids()().data())
+				{
+					const auto found = m_by_id.find(id_key_t{pair.first, pair.second().data()});
+					if(found != m_by_id.end()) append(found->second);
+				}
+
+				const auto found = m_by_title.find(title_key_t{pub().year(), pub().title()().data()});
+				if(found != m_by_title.end()) append(found->second);
+
+				// keep order of reference data and check every candidate once
+				std::sort(output.begin(), output.end());
+				output.erase(std::unique(output.begin(), output.end()), output.end());
+			}
+
+			void publication_index_t::lookup_similar(const objects::publication_t& pub,
+																  const double ratio, positions_t& output) const
+			{
+				output.clear();
+				const size_t length = pub().title()()->size();
+				if(length == 0ul) return;
+
+				const auto bucket = m_by_year.find(pub().year());
+				if(bucket == m_by_year.end()) return;
+
+				// |a - b| <= ratio * max(a, b), so b is in [a * (1 - ratio); a / (1 - ratio)]
+				const size_t min_length = length - fuzzy::max_distance(length, length, ratio);
+				const size_t max_length
+					 = static_cast<size_t>(static_cast<double>(length) / (1.0 - ratio)) + 1ul;
+
+				const auto& items = bucket->second;
+				auto it				= std::lower_bound(
+					 items.begin(), items.end(), std::make_pair(min_length, position_t{0}));
+				for(; it != items.end() && it->first <= max_length; ++it) output.push_back(it->second);
+			}
+
+			publication_columns_t::row_t publication_columns_t::row_t::make(
+				 const objects::publication_t& pub)
+			{
+				row_t result{pub().get_fingerprint(), nullptr, pub().ids()()->mask(), {}};
+				if(!pub().polish_title()()->empty())
+					result.polish_title = pub().polish_title()().data().handle();
+
+				result.ids.fill(nullptr);
+				for(const auto& pair: pub().ids()().data())
+					result.ids[static_cast<size_t>(pair.first)] = pair.second().data().handle();
+				return result;
+			}
+
+			void publication_columns_t::build(const report_collection_t& reference,
+														 const position_t begin, const position_t end)
+			{
+				const size_t count = end - begin;
+				m_begin				 = begin;
+				m_fingerprints.clear();
+				m_polish_titles.clear();
+				m_id_masks.clear();
+				m_ids.clear();
+				m_text.clear();
+				m_offsets.clear();
+
+				m_fingerprints.reserve(count);
+				m_polish_titles.reserve(count);
+				m_id_masks.reserve(count);
+				m_ids.reserve(count);
+				m_offsets.reserve(count + 1ul);
+				m_offsets.push_back(0u);
+
+				for(position_t pos = begin; pos < end; ++pos)
+				{
+					const objects::publication_t& ref = *(*reference[pos]())().reference()();
+					const row_t row							 = row_t::make(ref);
+					m_fingerprints.push_back(row.fingerprint);
+					m_polish_titles.push_back(row.polish_title);
+					m_id_masks.push_back(row.id_mask);
+					m_ids.push_back(row.ids);
+
+					m_text += ref().title()().data().get();
+					m_offsets.push_back(static_cast<uint32_t>(m_text.size()));
+				}
+			}
+
+			bool publication_columns_t::equal(const position_t pos, const row_t& row) const noexcept
+			{
+				const size_t i = pos - m_begin;
+
+				// the lowest common type of id decides, same as in `detail_publication_t::compare`
+				if(const id_mask_t common = m_id_masks[i] & row.id_mask; common != 0u)
+				{
+					const size_t type = static_cast<size_t>(std::countr_zero(common));
+					return m_ids[i][type] == row.ids[type];
+				}
+
+				// titles are interned, so after comparing fingerprints it is enough to compare handles
+				const objects::detail::title_fingerprint_t& fingerprint = m_fingerprints[i];
+				if((fingerprint <=> row.fingerprint) != 0
+					|| fingerprint.source != row.fingerprint.source)
+					return false;
+
+				const u16str* polish_title = m_polish_titles[i];
+				return polish_title == nullptr || row.polish_title == nullptr
+						 || polish_title == row.polish_title;
+			}
+
+			bool publication_columns_t::have_common_ids(const position_t pos,
+																	  const row_t& row) const noexcept
+			{
+				return (m_id_masks[pos - m_begin] & row.id_mask) != 0u;
+			}
+
+			void staged_matches_t::reset(const size_t report_size)
+			{
+				std::unique_lock<std::mutex> lck{m_mtx};
+				m_publications.clear();
+				m_slots = std::vector<std::atomic<size_t>>(report_size);
+				for(auto& slot: m_slots) slot.store(npos, std::memory_order_relaxed);
+			}
+
+			size_t staged_matches_t::retain(const std::vector<objects::shared_publication_t>& input)
+			{
+				std::unique_lock<std::mutex> lck{m_mtx};
+				const size_t offset = m_publications.size();
+				m_publications.insert(m_publications.end(), input.begin(), input.end());
+				return offset;
+			}
+
+			const objects::shared_publication_t* staged_matches_t::get(
+				 const position_t pos) const noexcept
+			{
+				const size_t value = m_slots[pos].load(std::memory_order_acquire);
+				if(value == npos) return nullptr;
+				return &m_publications[value & ~fuzzy_flag];
+			}
+		}	 // namespace detail
+
+		report_t merge_reports(const std::vector<report_t>& reports)
+		{
+			report_t result{new report_collection_t{}};
+			detail::publication_index_t index;
+			detail::publication_index_t::positions_t candidates;
+
+			for(const report_t& report: reports)
+			{
+				if(!report) continue;
+				for(const report_item_t& item: *report)
+				{
+					const objects::shared_publication_t& ref = (*item())().reference()();
+					const objects::publication_t& pub		  = *ref();
+					index.lookup(pub, candidates);
+
+					const auto same
+						 = std::find_if(candidates.begin(), candidates.end(), [&](const size_t pos) {
+								return (*(*(*result)[pos]())().reference()())().compare(pub) == 0;
+							});
+
+					if(same == candidates.end())
+					{
+						// new item, so matches of given reports are not modified
+						report_item_t to_add{};
+						(*to_add())().reference(ref);
+						(*to_add())().matched()().data() = (*item())().matched()().data();
+						index.insert(pub, result->size());
+						result->push_back(to_add);
+					}
+					else
+					{
+						auto& matches = (*(*result)[*same]())().matched()().data();
+						for(const auto& match: (*item())().matched()().data())
+							matches.emplace(match.first, match.second);
+					}
+				}
+			}
+
+			return result;
+		}
+
 		summary::summary(publications_storage_t reference) { activate(reference); }
 
+		summary::summary(std::shared_ptr<patterns::thread_pool> pool) : m_pool{pool}
+		{
+			check_nullptr{m_pool};
+		}
+
 
 		void summary::activate(publications_storage_t reference)
 		{
@@ -17,16 +259,63 @@ namespace core
 					(*to_add())().reference(ref);
 					obj->push_back(to_add);
 				}
+
+				// split report into contiguous shards, every shard has its own index
+				const size_t count
+					 = std::clamp(obj->size() / min_shard_size, size_t{1}, m_pool->size());
+				const size_t step = (obj->size() + count - 1ul) / count;
+				m_shards			   = std::vector<detail::report_shard_t>(count);
+				for(size_t i = 0; i < count; ++i)
+				{
+					m_shards[i].begin = std::min(i * step, obj->size());
+					m_shards[i].end	= std::min(m_shards[i].begin + step, obj->size());
+				}
+				m_pool->parallel_for(count, [&](const size_t i) {
+					m_shards[i].index.build(*obj, m_shards[i].begin, m_shards[i].end);
+					m_shards[i].columns.build(*obj, m_shards[i].begin, m_shards[i].end);
+				});
+
+				for(auto& staged: m_staged) staged.reset(obj->size());
 			});
-			is_ready.store(true);
+
+			{
+				std::unique_lock<std::mutex> lck{m_ready_mtx};
+				is_ready.store(true);
+			}
+			m_ready_cv.notify_all();
 		}
 
-		void summary::process(publications_storage_t input, const objects::match_type mt)
+		void summary::abort()
 		{
-			process_impl(input, mt);
+			{
+				std::unique_lock<std::mutex> lck{m_ready_mtx};
+				is_aborted.store(true);
+			}
+			m_ready_cv.notify_all();
 		}
 
-		summary::~summary() { invoke_on_done_helper(*this); }
+		void summary::process(publications_storage_t input, const objects::match_type mt,
+									 const std::stop_token& stop_token)
+		{
+			process_impl(input, mt, stop_token);
+		}
+
+		summary::~summary()
+		{
+			// destructor cannot throw, without `on_done` owner of summary gets no report and fails
+			try
+			{
+				invoke_on_done_helper(*this);
+			}
+			catch(const std::exception& e)
+			{
+				log.error() << "failed to finish report: " << e.what() << logger::endl;
+			}
+			catch(...)
+			{
+				log.error() << "failed to finish report, unknown error" << logger::endl;
+			}
+		}
 
 		void summary::safely_add_report(const report_item_t& item)
 		{
@@ -35,42 +324,130 @@ namespace core
 
 		void summary::invoke_on_done(report_t& obj) { on_done(obj); }
 
-		void summary::process_impl(publications_storage_t input, const objects::match_type mt)
+		void summary::materialize(report_t& obj)
 		{
-			// dassert(is_ready.load(), "first call activate()! summry is not ready!"_u8);
-			while(!is_ready.load()) { std::this_thread::yield(); };
-			using objects::publication_summary_t;
-			const objects::publication_with_source_t search{mt};
+			if(!is_ready.load()) return;
+			m_pool->parallel_for(m_shards.size(), [&](const size_t i) {
+				for(size_t pos = m_shards[i].begin; pos < m_shards[i].end; ++pos)
+				{
+					auto& matches = (*(*obj)[pos]())().matched()().data();
+					for(size_t mt = 0; mt < sources; ++mt)
+					{
+						const objects::shared_publication_t* pub = m_staged[mt].get(pos);
+						if(pub) matches.emplace(static_cast<objects::match_type>(mt), *pub);
+					}
+				}
+			});
+		}
+
+		void summary::process_impl(publications_storage_t input, const objects::match_type mt,
+											 const std::stop_token& stop_token)
+		{
+			{
+				std::unique_lock<std::mutex> lck{m_ready_mtx};
+				m_ready_cv.wait(lck, stop_token, [&] { return is_ready.load() || is_aborted.load(); });
+			}
+			dassert(is_ready.load(), "summary is aborted or stopped before activation!"_u8);
+			if(input.empty()) return;
+
 			report_t browser;
 			m_report.copy(browser);
+			auto& staged			 = m_staged[static_cast<size_t>(mt)];
+			const size_t offset = staged.retain(input);
+
+			// (1) exact matches, every shard is searched by another worker
+			std::vector<std::vector<uint8_t>> found_in_shard(m_shards.size());
+			m_pool->parallel_for(m_shards.size(), [&](const size_t i) {
+				match_exact(m_shards[i], input, offset, mt, found_in_shard[i]);
+			});
+
+			std::vector<uint8_t> found(input.size(), 0);
+			for(const auto& shard_found: found_in_shard)
+				for(size_t i = 0; i < input.size(); ++i) found[i] |= shard_found[i];
 
-			for(auto& item: *browser)
+			// (2) fuzzy matches for publications without exact equivalent
+			if(m_fuzzy_ratio.load() <= 0.0) return;
+			std::vector<std::vector<fuzzy_candidate_t>> best_in_shard(m_shards.size());
+			m_pool->parallel_for(m_shards.size(), [&](const size_t i) {
+				match_fuzzy(m_shards[i], input, found, mt, best_in_shard[i]);
+			});
+
+			// only the closest title is matched, to not spread one publication over many similar ones
+			for(size_t i = 0; i < input.size(); ++i)
 			{
-				auto& report_item = (*item())();
-				auto& matches		= report_item.matched()().data();
+				if(found[i]) continue;
+				fuzzy_candidate_t best{detail::staged_matches_t::npos, 0ul};
+				for(const auto& shard_best: best_in_shard) best = std::min(best, shard_best[i]);
+				if(best.first != detail::staged_matches_t::npos)
+					staged.claim(best.second, (offset + i) | detail::staged_matches_t::fuzzy_flag);
+			}
+		}
+
+		void summary::match_exact(const detail::report_shard_t& shard, publications_storage_t input,
+										  const size_t offset, const objects::match_type mt,
+										  std::vector<uint8_t>& found)
+		{
+			auto& staged = m_staged[static_cast<size_t>(mt)];
+			found.assign(input.size(), 0);
 
-				if(matches.find(search) != matches.end())
-					continue;	// it's allready matched, no sense for processing
-				const auto& ref = (*report_item.reference()().data())();
+			// every incoming publication is resolved with index, instead of scanning whole reference
+			detail::publication_index_t::positions_t candidates;
+			for(size_t i = 0; i < input.size(); ++i)
+			{
+				const auto& pub = *input[i]();
+				shard.index.lookup(pub, candidates);
+				if(candidates.empty()) continue;
 
-				for(const objects::shared_publication_t& y: input)
+				const auto row = detail::publication_columns_t::row_t::make(pub);
+				for(const size_t pos: candidates)
 				{
-					/**
-					 * @todo `compare` is minimum to make program works, but much much better results can be achieved 
-					 * by replacing this primitive function with on of theese algorithms
-					 * 
-					 * (1) https://en.wikipedia.org/wiki/Damerau%E2%80%93Levenshtein_distance
-					 * (2) https://en.wikipedia.org/wiki/Levenshtein_distance
-					 * 
-					 * Damerau–Levenshtein (1) distance probably will better fit here
-					 * 
-					 * This change is required to increase matching score, because often in titles, misspells occurs
-					 */
-					if(ref.compare(*y()) == 0)
-					{
-						m_report.access([&](report_t&) { matches.emplace(mt, y); });
-						break;
-					}
+					if(!shard.columns.equal(pos, row)) continue;
+					found[i] = 1;
+					staged.claim(pos, offset + i);
+				}
+			}
+		}
+
+		void summary::match_fuzzy(const detail::report_shard_t& shard, publications_storage_t input,
+										  const std::vector<uint8_t>& found, const objects::match_type mt,
+										  std::vector<fuzzy_candidate_t>& best)
+		{
+			const double ratio = m_fuzzy_ratio.load();
+			const auto& staged = m_staged[static_cast<size_t>(mt)];
+			best.assign(input.size(), fuzzy_candidate_t{detail::staged_matches_t::npos, 0ul});
+
+			detail::publication_index_t::positions_t candidates;
+			for(size_t i = 0; i < input.size(); ++i)
+			{
+				if(found[i]) continue;
+				const auto& pub	= *input[i]();
+				const u16str& title = pub().title()().data().get();
+				if(title.empty()) continue;
+
+				shard.index.lookup_similar(pub, ratio, candidates);
+				if(candidates.empty()) continue;
+
+				const fuzzy::pattern_t pattern{title};
+				const auto row = detail::publication_columns_t::row_t::make(pub);
+				for(const size_t pos: candidates)
+				{
+					if(staged.taken(pos)) continue;
+
+					// ids already said, that those are different
+					if(shard.columns.have_common_ids(pos, row)) continue;
+
+					const u16str_v ref_title = shard.columns.title(pos);
+
+					// found distance cannot be worse, than the best one so far; on equal distances
+					// lower position wins, so result does not depend on order of candidates and shards
+					size_t limit = fuzzy::max_distance(pattern.size(), ref_title.size(), ratio);
+					if(best[i].first != detail::staged_matches_t::npos)
+						limit = std::min(limit, best[i].first);
+
+					const size_t dist = fuzzy::distance(pattern, ref_title, limit);
+					if(dist > limit) continue;
+
+					best[i] = std::min(best[i], fuzzy_candidate_t{dist, pos});
 				}
 			}
 		}
@@ -0,0 +1,90 @@
+/**
+ * @file bgpolsl_parser.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks push parser of bg.polsl.pl responses
+*/
+
+// STL
+#include <list>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/bgpolsl_adapter/bgpolsl_adapter.h>
+
+// using namespace core;core::
+using ::logger;
+using typename core::str;
+using typename core::str_v;
+
+namespace bgpolsl_parser_tests_values
+{
+	// second record is not terminated with new line, so it's emitted by `finish`
+	const str body{
+		 "<html><body><table class=\"results\">\n"
+		 R"(<tr><td class="rec"><span class="field_id"><br/>)"
+		 R"(<span class="label" name="label_id">IDT:</span> 0000139000</span><br/>)"
+		 R"(<span class="label">Autorzy:</span> <a href="#">Żółć Łukasz</a>, )"
+		 R"(<a href="#">Gęś Ąna</a><br/>)"
+		 R"(<span class="label">Tytuł oryginału:</span> Zażółć gęślą jaźń<br/>)"
+		 R"(<span class="label">DOI:</span> 10.1000/ąę<br/>)"
+		 R"(<span class="label">Rok:</span> 2021</td></tr>)"
+		 "\n"
+		 "<tr><td>no record in this line</td></tr>\n"
+		 R"(<tr><td class="rec"><span class="field_id"><br/>)"
+		 R"(<span class="label" name="label_id">IDT:</span> 0000139001</span><br/>)"
+		 R"(<span class="label">Autorzy:</span> <a href="#">Źdźbło Ćma</a><br/>)"
+		 R"(<span class="label">Tytuł całości:</span> Śnieżna żaba<br/>)"
+		 R"(<span class="label">p-ISSN:</span> 1835-647X<br/>)"
+		 R"(<span class="label">Rok:</span> 2020</td></tr>)"};
+}	 // namespace bgpolsl_parser_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite bgpolsl_parser_tests = [] {
+		using namespace bgpolsl_parser_tests_values;
+		using core::network::bgpolsl_adapter;
+		using core::network::detail::bgpolsl_repr_t;
+		using core::network::detail::bgpolsl_stream_parser_t;
+
+		log.info() << "entering `bgpolsl_parser_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		const auto same = [](const bgpolsl_repr_t& lhs, const bgpolsl_repr_t& rhs) {
+			return lhs.idt == rhs.idt && lhs.year == rhs.year && lhs.authors == rhs.authors
+					 && lhs.org_title == rhs.org_title && lhs.whole_title == rhs.whole_title
+					 && lhs.p_issn == rhs.p_issn && lhs.doi == rhs.doi && lhs.e_issn == rhs.e_issn
+					 && lhs.affiliation == rhs.affiliation;
+		};
+
+		"case_01"_test = [] {
+			const auto records = bgpolsl_adapter::parse(body);
+			ut::expect(ut::fatal(ut::eq(records->size(), 2ul)));
+			ut::expect(records->front().idt == u"0000139000");
+			ut::expect(records->front().org_title == u"Zażółć gęślą jaźń");
+			ut::expect(records->back().whole_title == u"Śnieżna żaba");
+		};
+
+		"case_02"_test = [&] {
+			const auto expected = bgpolsl_adapter::parse(body);
+
+			// size 1 splits every line and every multibyte UTF-8 character
+			for(const size_t chunk_size: {1ul, 2ul, 3ul, 7ul, 64ul})
+			{
+				std::list<bgpolsl_repr_t> records;
+				bgpolsl_stream_parser_t parser{
+					 [&](bgpolsl_repr_t&& record) { records.emplace_back(std::move(record)); }};
+				for(size_t pos = 0; pos < body.size(); pos += chunk_size)
+					parser.feed(str_v{body}.substr(pos, chunk_size));
+				parser.finish();
+
+				ut::expect(ut::fatal(ut::eq(records.size(), expected->size())))
+					 << "chunk size: " << chunk_size;
+				ut::expect(std::equal(records.begin(), records.end(), expected->begin(), same))
+					 << "chunk size: " << chunk_size;
+			}
+		};
+	};
+}	 // namespace tests
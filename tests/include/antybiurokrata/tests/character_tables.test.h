@@ -0,0 +1,83 @@
+/**
+ * @file character_tables.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks locale independent classification and case mapping of characters
+*/
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/character_tables.hpp>
+
+namespace character_tables_tests_values
+{
+	// polish letters: lower case and expected upper case
+	constexpr char16_t lower_a_ogonek{u'ą'};
+	constexpr char16_t upper_a_ogonek{u'Ą'};
+	constexpr char16_t lower_l_stroke{u'ł'};
+	constexpr char16_t upper_l_stroke{u'Ł'};
+	constexpr char16_t lower_z_dot{u'ż'};
+	constexpr char16_t upper_z_dot{u'Ż'};
+
+	// Latin-1 letters, which upper case is not in Latin-1, or does not exist
+	constexpr char16_t sharp_s{u'ß'};
+	constexpr char16_t y_diaeresis{u'ÿ'};
+	constexpr char16_t upper_y_diaeresis{u'Ÿ'};
+	constexpr char16_t micro_sign{u'µ'};
+	constexpr char16_t greek_upper_mu{u'Μ'};
+
+	// placed between Latin-1 letters, but they are not letters
+	constexpr char16_t multiplication{u'×'};
+	constexpr char16_t division{u'÷'};
+}	 // namespace character_tables_tests_values
+
+namespace tests
+{
+	using namespace core;
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite character_tables_tests = [] {
+		log.info() << "entering `character_tables_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+		using namespace character_tables_tests_values;
+
+		"case_01"_test = [&] {
+			for(const auto& [lower, upper]: {std::pair{lower_a_ogonek, upper_a_ogonek},
+													  std::pair{lower_l_stroke, upper_l_stroke},
+													  std::pair{lower_z_dot, upper_z_dot}})
+			{
+				ut::expect(characters::is_alpha(lower) && characters::is_alpha(upper));
+				ut::expect(!characters::is_upper(lower) && characters::is_upper(upper));
+				ut::expect(characters::to_upper(lower) == upper);
+				ut::expect(characters::to_upper(upper) == upper);
+			}
+		};
+
+		"case_02"_test = [&] {
+			ut::expect(characters::is_alpha(sharp_s) && !characters::is_upper(sharp_s));
+			ut::expect(characters::to_upper(sharp_s) == sharp_s);
+
+			ut::expect(characters::is_alpha(y_diaeresis) && !characters::is_upper(y_diaeresis));
+			ut::expect(characters::to_upper(y_diaeresis) == upper_y_diaeresis);
+			ut::expect(characters::is_upper(upper_y_diaeresis));
+
+			ut::expect(characters::is_alpha(micro_sign) && !characters::is_upper(micro_sign));
+			ut::expect(characters::to_upper(micro_sign) == greek_upper_mu);
+		};
+
+		"case_03"_test = [&] {
+			for(const char16_t c: {multiplication, division})
+			{
+				ut::expect(!characters::is_alpha(c));
+				ut::expect(!characters::is_alnum(c));
+				ut::expect(!characters::is_upper(c));
+				ut::expect(characters::to_upper(c) == c);
+			}
+		};
+
+		"case_04"_test = [&] {
+			ut::expect(testbase::to_upper("Zażółć gęślą jaźń") == str{"ZAŻÓŁĆ GĘŚLĄ JAŹŃ"});
+			ut::expect(testbase::to_upper("ß × ÷ µ") == str{"ß × ÷ Μ"});
+		};
+	};
+}	 // namespace tests
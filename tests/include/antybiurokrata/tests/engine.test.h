@@ -0,0 +1,221 @@
+/**
+ * @file engine.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks engine in batch mode, with data sources replaced by prepared records
+*/
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/engine/engine.h>
+
+// using namespace core;core::
+using ::logger;
+
+namespace engine_tests_values
+{
+	using core::network::detail::bgpolsl_repr_t;
+	using core::network::detail::json_repr_t;
+
+	const core::str orcid{"0000-0002-1825-0097"};
+	const core::u16str affiliation{u"Kowalski Jan 0000-0002-1825-0097"};
+
+	/** @brief engine, that never connects to network, all data sources returns given records */
+	struct fake_engine_t : public core::engine
+	{
+		std::vector<bgpolsl_repr_t> reference;
+		std::list<json_repr_t> orcid_page;
+		bool reference_fails = false;
+
+		/** @brief download of reference for author with this name waits for `release` */
+		core::str blocked_name{};
+		std::promise<void> entered;
+		std::promise<void> release;
+
+		// worker calls overriden methods, so it has to be joined before this object dies
+		~fake_engine_t() { m_worker.reset(); }
+
+	 protected:
+		virtual void download_reference(const core::str& name, const core::str&,
+												  const record_function_t& on_record) override
+		{
+			if(!blocked_name.empty() && name == blocked_name)
+			{
+				entered.set_value();
+				release.get_future().wait();
+				return;
+			}
+			if(reference_fails)
+			{
+				// gives getters time to wait for summary
+				std::this_thread::sleep_for(std::chrono::milliseconds{100});
+				throw std::runtime_error{"bg.polsl.pl is not avaiable"};
+			}
+			for(bgpolsl_repr_t record: reference) on_record(std::move(record));
+		}
+
+		virtual void download_publications(const core::objects::match_type mt, const core::str&,
+													  const page_function_t& on_page) override
+		{
+			if(mt != core::objects::match_type::ORCID || orcid_page.empty()) return;
+			std::list<json_repr_t> page{orcid_page};
+			on_page(page);
+		}
+	};
+
+	inline bgpolsl_repr_t make_reference(const core::u16str& idt, const core::u16str& doi,
+													 const core::u16str& title)
+	{
+		bgpolsl_repr_t record{std::vector<core::str_v>{}};
+		record.idt			= idt;
+		record.doi			= doi;
+		record.year			= u"2021";
+		record.org_title	= title;
+		record.affiliation = affiliation;
+		return record;
+	}
+
+	inline json_repr_t make_orcid_record(const core::u16str& doi, const core::u16str& title)
+	{
+		json_repr_t record{};
+		record.orcid = core::u16str{orcid.begin(), orcid.end()};
+		record.year	 = u"2021";
+		record.title = title;
+		record.ids.emplace_back(u"DOI", doi);
+		return record;
+	}
+
+	/** @brief collects everything that engine sends in batch mode */
+	struct batch_output_t
+	{
+		std::atomic<size_t> errors{0ul};
+		std::atomic<size_t> finished_authors{0ul};
+		std::promise<core::reports::report_t> finished;
+
+		explicit batch_output_t(core::engine& eng)
+		{
+			eng.on_error.register_slot([this](const auto&) { ++errors; });
+			eng.on_author_finish.register_slot([this](const auto&) { ++finished_authors; });
+			eng.on_finish.register_slot(
+				 [this](const core::reports::report_t& report) { finished.set_value(report); });
+		}
+	};
+}	 // namespace engine_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite engine_tests = [] {
+		using namespace engine_tests_values;
+		log.info() << "entering `engine_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		constexpr auto timeout = std::chrono::seconds{30};
+
+		"case_01"_test = [&] {
+			fake_engine_t eng{};
+			batch_output_t output{eng};
+
+			// first one throws in worker, second one in download thread (not found)
+			eng.start({core::engine::author_t{"not an orcid"_u8, ""_u8, ""_u8},
+						  core::engine::author_t{""_u8, "Zzzyxw"_u8, "Qqqwerty"_u8}},
+						 2ul);
+
+			auto result		  = output.finished.get_future();
+			const auto status = result.wait_for(timeout);
+			ut::expect(ut::fatal(status == std::future_status::ready));
+			ut::expect(ut::eq(output.errors.load(), 2ul));
+			ut::expect(ut::eq(output.finished_authors.load(), 0ul));
+
+			const core::reports::report_t report = result.get();
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(report->empty());
+		};
+
+		"case_02"_test = [&] {
+			fake_engine_t eng{};
+			eng.reference.push_back(make_reference(u"0000000001", u"10.1000/abc", u"Matched title"));
+			eng.reference.push_back(make_reference(u"0000000002", u"10.1000/xyz", u"Other title"));
+			eng.orcid_page.push_back(make_orcid_record(u"10.1000/abc", u"Matched title"));
+			batch_output_t output{eng};
+
+			eng.start({core::engine::author_t{orcid, "Jan"_u8, "Kowalski"_u8}}, 1ul);
+
+			auto result		  = output.finished.get_future();
+			const auto status = result.wait_for(timeout);
+			ut::expect(ut::fatal(status == std::future_status::ready));
+			ut::expect(ut::eq(output.errors.load(), 0ul));
+			ut::expect(ut::eq(output.finished_authors.load(), 1ul));
+
+			const core::reports::report_t report = result.get();
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(ut::fatal(ut::eq(report->size(), 2ul)));
+
+			size_t matched = 0ul;
+			for(const auto& item: *report)
+				if((*item())().matched()().data().contains(core::objects::match_type::ORCID))
+					++matched;
+			ut::expect(ut::eq(matched, 1ul));
+		};
+
+		"case_03"_test = [&] {
+			// with orcid getters starts before reference is downloaded, so they cannot wait forever
+			fake_engine_t eng{};
+			eng.reference_fails = true;
+			eng.orcid_page.push_back(make_orcid_record(u"10.1000/abc", u"Matched title"));
+			batch_output_t output{eng};
+
+			eng.start({core::engine::author_t{orcid, "Jan"_u8, "Kowalski"_u8}}, 1ul);
+
+			auto result		  = output.finished.get_future();
+			const auto status = result.wait_for(timeout);
+			ut::expect(ut::fatal(status == std::future_status::ready));
+			ut::expect(ut::eq(output.errors.load(), 1ul));
+			ut::expect(ut::eq(output.finished_authors.load(), 0ul));
+
+			const core::reports::report_t report = result.get();
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(report->empty());
+		};
+
+		"case_04"_test = [&] {
+			// engine is stopped by destructor, while second author is processed
+			std::unique_ptr<fake_engine_t> eng{new fake_engine_t{}};
+			eng->reference.push_back(make_reference(u"0000000001", u"10.1000/abc", u"Matched title"));
+			eng->blocked_name = "Anna"_u8;
+			batch_output_t output{*eng};
+
+			eng->start({core::engine::author_t{orcid, "Jan"_u8, "Kowalski"_u8},
+							core::engine::author_t{""_u8, "Anna"_u8, "Nowak"_u8}},
+						  1ul);
+
+			const auto entered = eng->entered.get_future().wait_for(timeout);
+			ut::expect(ut::fatal(entered == std::future_status::ready));
+			// worker is joined in destructor, so download is released from other thread
+			std::jthread releaser{[raw = eng.get()] {
+				std::this_thread::sleep_for(std::chrono::milliseconds{100});
+				raw->release.set_value();
+			}};
+			eng.reset();
+
+			auto result = output.finished.get_future();
+			ut::expect(ut::fatal(result.wait_for(timeout) == std::future_status::ready));
+			ut::expect(ut::eq(output.errors.load(), 1ul));
+			ut::expect(ut::eq(output.finished_authors.load(), 1ul));
+
+			const core::reports::report_t report = result.get();
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(ut::eq(report->size(), 1ul));
+		};
+	};
+}	 // namespace tests
@@ -0,0 +1,74 @@
+/**
+ * @file fuzzy_matcher.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks bit-parallel Damerau–Levenshtein distance
+*/
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/fuzzy_matcher/fuzzy_matcher.h>
+
+// using namespace core;core::
+using ::logger;
+using typename core::u16str_v;
+
+namespace fuzzy_matcher_tests_values
+{
+	constexpr u16str_v title_01{u"ANALIZAPRZEPLYWUCIEPLA"};
+	constexpr u16str_v title_02{u"ANALIZAPRZEPLYWUCIPELA"};	 // transposition
+	constexpr u16str_v title_03{u"ANALIZAPRZEPYWUCIEPLA"};	 // deletion
+	constexpr u16str_v title_04{u"ANALIZAXPRZEPLYWUCIEPLAX"};	 // two insertions
+	constexpr u16str_v title_05{u"CA"};
+	constexpr u16str_v title_06{u"ABC"};
+	constexpr u16str_v title_07{u""};
+	constexpr u16str_v title_08{u"ĄĘŚ"};
+	constexpr u16str_v title_09{u"ĘĄŚ"};
+}	 // namespace fuzzy_matcher_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite fuzzy_matcher_tests = [] {
+		using namespace fuzzy_matcher_tests_values;
+		using namespace core::reports::fuzzy;
+		log.info() << "entering `fuzzy_matcher_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		"case_01"_test = [] {
+			ut::expect(ut::eq(distance(title_01, title_01), 0ul));
+			ut::expect(ut::eq(distance(title_01, title_02), 1ul));
+			ut::expect(ut::eq(distance(title_01, title_03), 1ul));
+			ut::expect(ut::eq(distance(title_01, title_04), 2ul));
+		};
+
+		"case_02"_test = [] {
+			// optimal string alignment does not edit transposed characters again
+			ut::expect(ut::eq(distance(title_05, title_06), 3ul));
+			ut::expect(ut::eq(distance(title_07, title_06), 3ul));
+			ut::expect(ut::eq(distance(title_06, title_07), 3ul));
+			ut::expect(ut::eq(distance(title_08, title_09), 1ul));
+		};
+
+		"case_03"_test = [] {
+			// patterns longer than one machine word
+			core::u16str lhs, rhs;
+			for(size_t i = 0; i < 150ul; ++i)
+				lhs += static_cast<core::u16char_t>(u'A' + (i * 7ul) % 26ul);
+			rhs = lhs;
+			std::swap(rhs[63], rhs[64]);
+			rhs[130] = u'Ż';
+			rhs.erase(5, 1);
+			ut::expect(ut::eq(distance(lhs, rhs), 3ul));
+		};
+
+		"case_04"_test = [] {
+			const pattern_t pattern{title_01};
+			ut::expect(ut::eq(distance(pattern, title_04, 1ul), 2ul));
+			ut::expect(ut::eq(distance(pattern, title_04, 2ul), 2ul));
+			ut::expect(ut::eq(distance(pattern, title_05, 5ul), 6ul));
+			ut::expect(ut::eq(max_distance(title_01.size(), title_04.size(), 0.1), 2ul));
+		};
+	};
+}	 // namespace tests
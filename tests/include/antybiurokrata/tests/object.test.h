@@ -18,7 +18,8 @@ namespace object_tests_values
 	namespace orcid
 	{
 		constexpr u16str_v correct_01{u"0000-0000-0000-0001"};
-		constexpr u16str_v correct_02{u"0000-0000-0000-0000"};
+		constexpr u16str_v correct_02{u"0000-0002-1825-0097"};
+		constexpr u16str_v correct_03{u"0000-0002-1694-233X"};
 
 		constexpr u16str_v invalid_01{u"0000-0000-0000-000"};
 		constexpr u16str_v invalid_02{u"0000-0000-000-0000"};
@@ -28,6 +29,10 @@ namespace object_tests_values
 		constexpr u16str_v invalid_06{u"0000-0000-0000"};
 		constexpr u16str_v invalid_07{u"000000000000000"};
 		constexpr u16str_v invalid_08{u"---"};
+		constexpr u16str_v invalid_09{u"0000-0000-0000-0000"};	 // wrong check digit
+		constexpr u16str_v invalid_10{u"0000-0002-1825-0098"};	 // wrong check digit
+		constexpr u16str_v invalid_11{u"0000-0002-1694-2330"};	 // wrong check digit
+		constexpr u16str_v invalid_12{u"0000-0002-1X94-2330"};
 	}	 // namespace orcid
 
 	namespace names
@@ -78,6 +83,7 @@ namespace tests
 		"case_01"_test = [&] {
 			validation_success(correct_01);
 			validation_success(correct_02);
+			validation_success(correct_03);
 
 			validation_fail(invalid_01);
 			validation_fail(invalid_02);
@@ -87,18 +93,30 @@ namespace tests
 			validation_fail(invalid_06);
 			validation_fail(invalid_07);
 			validation_fail(invalid_08);
+			validation_fail(invalid_09);
+			validation_fail(invalid_10);
+			validation_fail(invalid_11);
+			validation_fail(invalid_12);
 		};
 
 		"case_02"_test = [&] {
 			orcid_t orcid{correct_01};
 			ut::expect(ut::eq(static_cast<str>(orcid()),
-									get_conversion_engine().to_bytes(correct_01.data())));
+									core::transcoding::to_utf8(correct_01.data())));
 		};
 
 		"case_03"_test = [&] {
 			ut::expect(
 				 ut::throws<core::exceptions::assert_exception<str>>([] { orcid_t{invalid_01}; }));
 		};
+
+		"case_04"_test = [&] {
+			orcid_t orcid{correct_03};
+			ut::expect(ut::eq(static_cast<str>(orcid()),
+									core::transcoding::to_utf8(correct_03.data())));
+			ut::expect(ut::eq(orcid_t::value_t::check_digit(orcid().identifier()), 10));
+			ut::expect(orcid() == orcid_t::value_t::from_string(str_v{"0000-0002-1694-233X"}));
+		};
 	};
 
 	const ut::suite polish_name_tests = [] {
@@ -109,7 +127,7 @@ namespace tests
 
 		"case_01"_test = [] {
 			const auto validate_data = [&](const str_v& x) {
-				ut::expect(core::get_conversion_engine().from_bytes(testbase::to_upper(x))
+				ut::expect(core::transcoding::to_utf16(testbase::to_upper(x))
 							  == (u16str_v)polish_name_t{x}());
 			};
 
@@ -156,5 +174,133 @@ namespace tests
 																				names::correct_pn_02,
 																				orcid::correct_01));
 		};
+
+		"case_02"_test = [] {
+			ut::expect(testbase::check_binary_serialization<person_t>());
+			ut::expect(testbase::check_binary_serialization<person_t>(names::correct_pn_01,
+																						 names::correct_pn_02,
+																						 orcid::correct_01));
+		};
+	};
+
+	const ut::suite ids_storage_tests = [] {
+		using namespace core::objects;
+		log.info() << "entering `ids_storage_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		using ids_list_t = std::initializer_list<std::pair<id_type, u16str>>;
+
+		const auto make_publication = [](const ids_list_t ids) {
+			publication_t pub{};
+			pub().title()() = u16str{u"TITLE"};
+			pub().year(2021);
+			for(const auto& pair: ids) pub().ids()().data()[pair.first] = pair.second;
+			return pub;
+		};
+
+		"case_01"_test = [&] {
+			const publication_t pub
+				 = make_publication({{id_type::ISBN, u"978-3"}, {id_type::DOI, u"10.1000/abc"}});
+			const auto& ids = pub().ids()().data();
+
+			ut::expect(ut::eq(ids.size(), 2ul));
+			ut::expect(ids.contains(id_type::DOI));
+			ut::expect(!ids.contains(id_type::EID));
+			ut::expect(ids.find(id_type::EID) == nullptr);
+
+			// keys are visited in ascending order
+			std::vector<id_type> keys;
+			for(const auto& pair: ids) keys.push_back(pair.first);
+			ut::expect(keys == std::vector<id_type>{id_type::DOI, id_type::ISBN});
+		};
+
+		"case_02"_test = [&] {
+			const publication_t p1 = make_publication({{id_type::DOI, u"10.1000/abc"}});
+			const publication_t p2
+				 = make_publication({{id_type::DOI, u"10.1000/ABC"}, {id_type::EID, u"1"}});
+			const publication_t p3 = make_publication({{id_type::DOI, u"10.1000/xyz"}});
+			const publication_t p4 = make_publication({{id_type::EID, u"2"}});
+
+			ut::expect(p1() == p2());	// common DOI decides
+			ut::expect(p1() != p3());
+			ut::expect(p1() == p4());	// no common ids, equal titles and years
+			ut::expect(p2() != p4());
+		};
+
+		"case_03"_test = [&] {
+			const publication_t pub
+				 = make_publication({{id_type::IDT, u"123"}, {id_type::WOSUID, u"000123"}});
+
+			std::stringstream ss;
+			publication_t text{};
+			ss << pub;
+			ss >> text;
+			ut::expect(ut::eq(text().ids()()->mask(), pub().ids()()->mask()));
+			ut::expect(pub() == text());
+
+			std::stringstream bs;
+			publication_t binary{};
+			bs << patterns::serial::serialize_binary{pub};
+			bs >> patterns::serial::deserialize_binary{binary};
+			ut::expect(ut::eq(binary().ids()()->mask(), pub().ids()()->mask()));
+			ut::expect(pub() == binary());
+		};
+
+		"case_04"_test = [&] {
+			namespace binary = patterns::serial::binary;
+
+			// lengths from corrupted stream are rejected, before memory for them is allocated
+			std::stringstream huge;
+			binary::write_raw<binary::size_type>(huge, std::numeric_limits<binary::size_type>::max());
+			u16str text{};
+			ut::expect(ut::throws<std::runtime_error>([&] { binary::get(huge, text); }));
+
+			std::stringstream truncated;
+			binary::write_raw<binary::size_type>(truncated, 1000u);
+			binary::put(truncated, u'x');
+			ut::expect(ut::throws<std::runtime_error>([&] { binary::get(truncated, text); }));
+
+			std::stringstream collection;
+			binary::write_raw<binary::size_type>(collection, binary::max_length);
+			std::vector<u16str> texts{};
+			ut::expect(ut::throws<std::runtime_error>([&] { binary::get(collection, texts); }));
+			ut::expect(texts.capacity() <= binary::max_preallocated);
+
+			const publication_t pub = make_publication({{id_type::DOI, u"10.1000/abc"}});
+			std::stringstream bs;
+			bs << patterns::serial::serialize_binary{pub};
+			const str bytes = bs.str();
+			std::stringstream cut{bytes.substr(0, bytes.size() / 2ul)};
+			publication_t broken{};
+			ut::expect(ut::throws<std::runtime_error>(
+				 [&] { cut >> patterns::serial::deserialize_binary{broken}; }));
+		};
+	};
+
+	const ut::suite match_storage_tests = [] {
+		using namespace core::objects;
+		log.info() << "entering `match_storage_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		"case_01"_test = [] {
+			shared_publication_t first{}, second{};
+			publication_summary_t item{};
+			auto& matched = (*item())().matched()().data();
+
+			ut::expect(matched.emplace(match_type::SCOPUS, first));
+			ut::expect(!matched.emplace(match_type::SCOPUS, second));	// first match of source wins
+			ut::expect(matched.emplace(match_type::POLSL, second));
+
+			ut::expect(ut::eq(matched.size(), 2ul));
+			ut::expect(ut::eq(matched.mask(), (1u << static_cast<uint32_t>(match_type::POLSL))
+															 | (1u << static_cast<uint32_t>(match_type::SCOPUS))));
+			ut::expect((*matched.find(match_type::SCOPUS))().data() == first().data());
+
+			std::stringstream bs;
+			publication_summary_t binary{};
+			bs << patterns::serial::serialize_binary{item};
+			bs >> patterns::serial::deserialize_binary{binary};
+			ut::expect(ut::eq((*binary())().matched()().data().mask(), matched.mask()));
+		};
 	};
 }	 // namespace tests
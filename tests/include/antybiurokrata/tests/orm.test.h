@@ -0,0 +1,124 @@
+/**
+ * @file orm.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks registry of unique persons, used by converters from adapters output
+*/
+
+// STL
+#include <memory>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/orm/orm.h>
+
+// using namespace core;core::
+using ::logger;
+
+namespace orm_tests_values
+{
+	using core::objects::person_t;
+	using core::objects::shared_person_t;
+
+	constexpr core::u16str_v orcid_01{u"0000-0002-1825-0097"};
+	constexpr core::u16str_v orcid_02{u"0000-0002-1694-233X"};
+	constexpr core::u16str_v orcid_03{u"0000-0000-0000-0001"};
+
+	/** @brief creates person, without orcid if it is empty */
+	inline shared_person_t make_person(const core::u16str_v name, const core::u16str_v surname,
+												  const core::u16str_v orcid = {})
+	{
+		shared_person_t result{std::make_shared<person_t>()};
+		person_t& person = *result();
+		person().name(name);
+		person().surname(surname);
+		if(!orcid.empty())
+			person().orcid(core::objects::orcid_t::value_t::from_string(orcid));
+		return result;
+	}
+}	 // namespace orm_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite persons_registry_tests = [] {
+		using namespace orm_tests_values;
+		using core::orm::persons_registry_t;
+		log.info() << "entering `persons_registry_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		constexpr auto npos = persons_registry_t::npos;
+
+		"case_01"_test = [&] {
+			// the same orcid is the same person, whatever names are
+			persons_registry_t registry{};
+			const auto added = registry.insert(make_person(u"Jan", u"Kowalski", orcid_01));
+			ut::expect(added.second);
+			ut::expect(ut::eq(added.first, 0u));
+
+			const auto renamed = registry.insert(make_person(u"Janusz", u"Nowak", orcid_01));
+			ut::expect(!renamed.second);
+			ut::expect(ut::eq(renamed.first, 0u));
+			ut::expect(ut::eq(registry.find(*make_person(u"Anna", u"Kowalska", orcid_01)()), 0u));
+			ut::expect(ut::eq(registry.size(), 1ul));
+
+			// first added names are kept
+			ut::expect(ut::eq((*registry[0]())().name()().raw.get(), core::u16str{u"Jan"}));
+		};
+
+		"case_02"_test = [&] {
+			// different, valid orcids are different persons, even with the same names
+			persons_registry_t registry{};
+			const auto first	= registry.insert(make_person(u"Jan", u"Kowalski", orcid_01));
+			const auto second = registry.insert(make_person(u"Jan", u"Kowalski", orcid_02));
+			ut::expect(first.second);
+			ut::expect(second.second);
+			ut::expect(ut::neq(first.first, second.first));
+			ut::expect(ut::eq(registry.size(), 2ul));
+
+			ut::expect(
+				 ut::eq(registry.find(*make_person(u"Jan", u"Kowalski", orcid_01)()), first.first));
+			ut::expect(
+				 ut::eq(registry.find(*make_person(u"Jan", u"Kowalski", orcid_02)()), second.first));
+			ut::expect(ut::eq(registry.find(*make_person(u"Jan", u"Kowalski", orcid_03)()), npos));
+
+			// without orcid only names can be compared, so the first one matches
+			ut::expect(ut::eq(registry.find(*make_person(u"Jan", u"Kowalski")()), first.first));
+		};
+
+		"case_03"_test = [&] {
+			// person without orcid is the same as person with the same names and any orcid
+			persons_registry_t registry{};
+			const auto without_orcid = registry.insert(make_person(u"Jan", u"Kowalski"));
+			ut::expect(without_orcid.second);
+
+			const auto with_orcid = registry.insert(make_person(u"Jan", u"Kowalski", orcid_01));
+			ut::expect(!with_orcid.second);
+			ut::expect(ut::eq(with_orcid.first, without_orcid.first));
+			ut::expect(ut::eq(registry.find(*make_person(u"Jan", u"Kowalski", orcid_02)()),
+									without_orcid.first));
+
+			// names still have to be equal
+			ut::expect(ut::eq(registry.find(*make_person(u"Anna", u"Kowalski")()), npos));
+			ut::expect(ut::eq(registry.find(*make_person(u"Jan", u"Nowak", orcid_01)()), npos));
+			ut::expect(ut::eq(registry.size(), 1ul));
+		};
+
+		"case_04"_test = [&] {
+			// same as above, but person with orcid is known first
+			persons_registry_t registry{};
+			const auto with_orcid = registry.insert(make_person(u"Jan", u"Kowalski", orcid_01));
+			ut::expect(with_orcid.second);
+
+			const auto without_orcid = registry.insert(make_person(u"Jan", u"Kowalski"));
+			ut::expect(!without_orcid.second);
+			ut::expect(ut::eq(without_orcid.first, with_orcid.first));
+
+			// names are unified, so they are compared without case
+			ut::expect(ut::eq(registry.find(*make_person(u"JAN", u"kowalski")()), with_orcid.first));
+			ut::expect(ut::eq(registry.find(*make_person(u"Jan", u"Nowak")()), npos));
+			ut::expect(ut::eq(registry.size(), 1ul));
+		};
+	};
+}	 // namespace tests
@@ -0,0 +1,142 @@
+/**
+ * @file response_cache.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks persistent cache of http responses
+*/
+
+// STL
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/response_cache/response_cache.h>
+
+// using namespace core;core::
+using ::logger;
+
+namespace response_cache_tests_values
+{
+	using core::network::response_cache;
+
+	/** @brief empty directory for one test case, removed with this object */
+	struct temporary_directory_t
+	{
+		const std::filesystem::path path;
+
+		explicit temporary_directory_t(const core::str& name) :
+			 path{std::filesystem::temp_directory_path() / "antybiurokrata_tests" / name}
+		{
+			std::filesystem::remove_all(path);
+		}
+
+		~temporary_directory_t()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(path, ec);
+		}
+	};
+
+	/** @brief name of cache file for given key */
+	inline core::str file_name(const core::str_v& key)
+	{
+		const response_cache::hash_t h = response_cache::hash(key);
+		char name[64];
+		std::snprintf(name, sizeof(name), "%016llx%016llx.bin", static_cast<unsigned long long>(h[0]),
+						  static_cast<unsigned long long>(h[1]));
+		return core::str{name};
+	}
+}	 // namespace response_cache_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite response_cache_tests = [] {
+		using namespace response_cache_tests_values;
+		log.info() << "entering `response_cache_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		constexpr response_cache::duration_t hour{3600};
+
+		"case_01"_test = [&] {
+			const temporary_directory_t dir{"case_01"};
+			{
+				response_cache cache{dir.path};
+				ut::expect(!cache.get("GET /a", hour).has_value());
+
+				cache.put("GET /a", "body of a");
+				const auto body = cache.get("GET /a", hour);
+				ut::expect(ut::fatal(body.has_value()));
+				ut::expect(ut::eq(*body, core::str{"body of a"}));
+				ut::expect(!cache.get("GET /b", hour).has_value());
+			}
+
+			// directory is private and responses survive restart
+			const auto perms = std::filesystem::status(dir.path).permissions();
+			ut::expect(perms == std::filesystem::perms::owner_all);
+
+			response_cache cache{dir.path};
+			const auto body = cache.get("GET /a", hour);
+			ut::expect(ut::fatal(body.has_value()));
+			ut::expect(ut::eq(*body, core::str{"body of a"}));
+		};
+
+		"case_02"_test = [&] {
+			const temporary_directory_t dir{"case_02"};
+			response_cache cache{dir.path};
+			cache.put("GET /a", "body of a");
+			ut::expect(cache.size() > 0ul);
+
+			// age is counted in whole seconds
+			std::this_thread::sleep_for(std::chrono::milliseconds{1100});
+			ut::expect(cache.get("GET /a", hour).has_value());
+			ut::expect(!cache.get("GET /a", response_cache::duration_t{0}).has_value());
+
+			// expired response is removed
+			ut::expect(!cache.get("GET /a", hour).has_value());
+			ut::expect(ut::eq(cache.size(), 0ul));
+		};
+
+		"case_03"_test = [&] {
+			const temporary_directory_t dir{"case_03"};
+			const core::str body(1000ul, 'x');
+
+			// room for two responses
+			response_cache cache{dir.path, 2500ul};
+			cache.put("GET /a", body);
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			cache.put("GET /b", body);
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+			// `a` is used, so `b` is the least recently used one
+			ut::expect(cache.get("GET /a", hour).has_value());
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			cache.put("GET /c", body);
+
+			ut::expect(cache.size() <= 2500ul);
+			ut::expect(cache.get("GET /a", hour).has_value());
+			ut::expect(!cache.get("GET /b", hour).has_value());
+			ut::expect(cache.get("GET /c", hour).has_value());
+		};
+
+		"case_04"_test = [&] {
+			const temporary_directory_t dir{"case_04"};
+			{
+				response_cache cache{dir.path};
+				cache.put("GET /b", "body of b");
+			}
+
+			// file of `b` pretends to be response for `a`, as if hashes of both keys were equal
+			std::filesystem::rename(dir.path / file_name("GET /b"), dir.path / file_name("GET /a"));
+
+			response_cache cache{dir.path};
+			ut::expect(cache.size() > 0ul);
+			ut::expect(!cache.get("GET /a", hour).has_value());
+			ut::expect(!cache.get("GET /b", hour).has_value());
+		};
+	};
+}	 // namespace tests
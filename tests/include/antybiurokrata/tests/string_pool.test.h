@@ -0,0 +1,118 @@
+/**
+ * @file string_pool.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks pool of interned strings and handles to them
+*/
+
+// STL
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/objects/string_pool.h>
+
+// using namespace core;core::
+using ::logger;
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite string_pool_tests = [] {
+		using core::objects::detail::interned_u16str_t;
+		using core::objects::detail::string_pool_t;
+		log.info() << "entering `string_pool_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		string_pool_t& pool = string_pool_t::global();
+
+		"case_01"_test = [&] {
+			const interned_u16str_t s1{core::u16str_v{u"string_pool_case_01"}};
+			const interned_u16str_t s2{core::u16str{u"string_pool_case_01"}};
+			const interned_u16str_t s3{s1};
+			const interned_u16str_t other{core::u16str_v{u"string_pool_case_01_other"}};
+
+			ut::expect(s1 == s2);
+			ut::expect(s1 == s3);
+			ut::expect(ut::eq(s1.handle(), s2.handle()));
+			ut::expect(s1 != other);
+			ut::expect(s1 == core::u16str_v{u"string_pool_case_01"});
+			ut::expect(s1.get() == u"string_pool_case_01");
+
+			// empty strings are not kept in pool
+			const interned_u16str_t empty{core::u16str_v{u""}};
+			ut::expect(empty == interned_u16str_t{});
+			ut::expect(empty.empty());
+		};
+
+		"case_02"_test = [&] {
+			// ordering is the same as for not interned strings
+			const std::vector<core::u16str> values{u"", u"a", u"B", u"ab", u"ba", u"abc", u"Ab", u"a"};
+			for(const auto& v1: values)
+				for(const auto& v2: values)
+				{
+					const interned_u16str_t s1{v1};
+					const interned_u16str_t s2{v2};
+					ut::expect((s1 <=> s2) == (v1 <=> v2));
+					ut::expect(ut::eq(s1 < s2, v1 < v2));
+					ut::expect(ut::eq(s1 == s2, v1 == v2));
+				}
+		};
+
+		"case_03"_test = [&] {
+			// string is released with the last handle
+			const size_t before = pool.size();
+			{
+				interned_u16str_t s1{core::u16str_v{u"string_pool_case_03"}};
+				ut::expect(ut::eq(pool.size(), before + 1ul));
+
+				interned_u16str_t s2{s1};
+				interned_u16str_t s3{std::move(s1)};
+				ut::expect(s1.empty());
+				s2 = core::u16str_v{u"string_pool_case_03_other"};
+				ut::expect(ut::eq(pool.size(), before + 2ul));
+
+				s2 = s3;
+				ut::expect(ut::eq(pool.size(), before + 1ul));
+				ut::expect(s2 == s3);
+			}
+			ut::expect(ut::eq(pool.size(), before));
+		};
+
+		"case_04"_test = [&] {
+			constexpr size_t threads_count = 8ul;
+			constexpr size_t values_count	 = 200ul;
+			const size_t before				 = pool.size();
+
+			// every thread interns the same strings, some of them are released meanwhile
+			std::vector<std::vector<interned_u16str_t>> results(threads_count);
+			{
+				std::vector<std::jthread> threads;
+				for(size_t t = 0; t < threads_count; ++t)
+					threads.emplace_back([&results, t] {
+						for(size_t i = 0; i < values_count; ++i)
+						{
+							const std::string value = "string_pool_case_04_" + std::to_string(i);
+							const core::u16str wide{value.begin(), value.end()};
+							results[t].emplace_back(wide);
+							const interned_u16str_t temporary{wide + u"_temporary"};
+						}
+					});
+			}
+
+			ut::expect(ut::eq(pool.size(), before + values_count));
+			for(size_t t = 1; t < threads_count; ++t)
+				ut::expect(std::equal(results[t].begin(), results[t].end(), results[0].begin(),
+											 [](const auto& s1, const auto& s2) {
+												 return s1.handle() == s2.handle();
+											 }));
+
+			results.clear();
+			ut::expect(ut::eq(pool.size(), before));
+		};
+	};
+}	 // namespace tests
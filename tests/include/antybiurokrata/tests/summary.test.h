@@ -0,0 +1,474 @@
+/**
+ * @file summary.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks index of reference publications and matching of summary, by comparing
+ * them with full scan
+*/
+
+// STL
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/summary/summary.h>
+
+// using namespace core;core::
+using ::logger;
+using typename core::u16str;
+
+namespace summary_tests_values
+{
+	using namespace core::objects;
+	using core::reports::report_collection_t;
+	using positions_t = core::reports::detail::publication_index_t::positions_t;
+	using ids_list_t  = std::initializer_list<std::pair<id_type, u16str>>;
+
+	/** @brief xorshift, so every run checks the same data */
+	struct generator_t
+	{
+		uint64_t state{0x9e3779b97f4a7c15ul};
+
+		size_t below(const size_t n)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return static_cast<size_t>(state % n);
+		}
+	};
+
+	inline shared_publication_t make_publication(const u16str& title, const uint16_t year,
+																const ids_list_t ids)
+	{
+		shared_publication_t result{};
+		(*result())().title()() = title;
+		(*result())().year(year);
+		for(const auto& pair: ids) (*result())().ids()().data()[pair.first] = pair.second;
+		(*result())().update_fingerprint();
+		return result;
+	}
+
+	/** @brief titles from small alphabet, so many of them are similar */
+	inline u16str random_title(generator_t& gen, const size_t min_length, const size_t max_length)
+	{
+		u16str result(min_length + gen.below(max_length - min_length + 1ul), u'A');
+		for(auto& c: result) c = static_cast<core::u16char_t>(u'A' + gen.below(4ul));
+		return result;
+	}
+
+	/** @brief publication with random year and title, often sharing ids with others */
+	inline shared_publication_t random_publication(generator_t& gen)
+	{
+		const u16str title	= random_title(gen, 8ul, 14ul);
+		const uint16_t year = static_cast<uint16_t>(2019ul + gen.below(3ul));
+		shared_publication_t result = make_publication(title, year, {});
+
+		// bit 0 adds DOI, bit 1 adds IDT
+		const size_t ids = gen.below(4ul);
+		auto& storage	  = (*result())().ids()().data();
+		if(ids & 1ul)
+			storage[id_type::DOI]
+				 = u"10.1000/" + u16str(1ul, static_cast<core::u16char_t>(u'a' + gen.below(20ul)));
+		if(ids & 2ul)
+			storage[id_type::IDT] = u16str(1ul, static_cast<core::u16char_t>(u'0' + gen.below(10ul)));
+		return result;
+	}
+
+	inline report_collection_t make_report(const std::vector<shared_publication_t>& reference)
+	{
+		report_collection_t result;
+		for(const auto& ref: reference)
+		{
+			core::reports::report_item_t item{};
+			(*item())().reference(ref);
+			result.push_back(item);
+		}
+		return result;
+	}
+
+	inline const publication_t& reference_at(const report_collection_t& report, const size_t pos)
+	{
+		return *(*report[pos]())().reference()();
+	}
+
+	/** @brief the same candidates as index has to find, collected by checking every position */
+	inline positions_t scan(const report_collection_t& report, const size_t begin, const size_t end,
+									const publication_t& pub)
+	{
+		positions_t result;
+		for(size_t pos = begin; pos < end; ++pos)
+		{
+			const publication_t& ref = reference_at(report, pos);
+			bool candidate				 = ref().year() == pub().year()
+								&& ref().title()().data().get() == pub().title()().data().get();
+			for(const auto& pair: pub().ids()().data())
+			{
+				const auto* other = ref().ids()().data().find(pair.first);
+				if(other && (*other)().data().get() == pair.second().data().get()) candidate = true;
+			}
+			if(candidate) result.push_back(pos);
+		}
+		return result;
+	}
+
+	/** @brief copy of given publication, with title changed on given positions */
+	inline shared_publication_t with_typos(const shared_publication_t& pub,
+														const std::initializer_list<size_t> positions,
+														const ids_list_t ids)
+	{
+		u16str title = (*pub())().title()().data().get();
+		for(const size_t pos: positions) title[pos] = title[pos] == u'Z' ? u'Y' : u'Z';
+		return make_publication(title, (*pub())().year(), ids);
+	}
+
+	/** @brief copy of given publication with the same title, year and ids */
+	inline shared_publication_t copy_of(const shared_publication_t& pub)
+	{
+		shared_publication_t result
+			 = make_publication((*pub())().title()().data().get(), (*pub())().year(), {});
+		(*result())().ids()().data() = (*pub())().ids()().data();
+		return result;
+	}
+
+	/**
+	 * @brief matches of one source, found by comparing every input publication with every
+	 * reference publication, one batch after another
+	 * 
+	 * @return std::vector<size_t> for every reference publication position in all batches joined
+	 * together, optionally with `fuzzy_flag`, or `npos`
+	 */
+	inline std::vector<size_t> sequential_matches(
+		 const std::vector<shared_publication_t>& reference,
+		 const std::vector<std::vector<shared_publication_t>>& batches, const double ratio)
+	{
+		using core::reports::detail::staged_matches_t;
+		namespace fuzzy = core::reports::fuzzy;
+		constexpr size_t npos = staged_matches_t::npos;
+
+		std::vector<size_t> slots(reference.size(), npos);
+		size_t offset = 0ul;
+		for(const auto& batch: batches)
+		{
+			// exact matches, every equal reference publication is matched
+			std::vector<uint8_t> found(batch.size(), 0);
+			for(size_t i = 0; i < batch.size(); ++i)
+				for(size_t pos = 0; pos < reference.size(); ++pos)
+					if((*reference[pos]())().compare((*batch[i]())()) == 0)
+					{
+						found[i]		= 1;
+						slots[pos] = std::min(slots[pos], offset + i);
+					}
+
+			// the closest free title from the same year, without common ids
+			std::vector<std::pair<size_t, size_t>> best(batch.size(), {npos, 0ul});
+			for(size_t i = 0; i < batch.size(); ++i)
+			{
+				const publication_t& pub = *batch[i]();
+				const u16str& title		 = pub().title()().data().get();
+				if(found[i] || title.empty()) continue;
+
+				for(size_t pos = 0; pos < reference.size(); ++pos)
+				{
+					const publication_t& ref = *reference[pos]();
+					if(slots[pos] != npos || ref().year() != pub().year()
+						|| (ref().ids()()->mask() & pub().ids()()->mask()) != 0u)
+						continue;
+
+					const u16str& ref_title = ref().title()().data().get();
+					const size_t dist			= fuzzy::distance(title, ref_title);
+					if(dist <= fuzzy::max_distance(title.size(), ref_title.size(), ratio))
+						best[i] = std::min(best[i], std::pair{dist, pos});
+				}
+			}
+
+			for(size_t i = 0; i < batch.size(); ++i)
+				if(best[i].first != npos)
+					slots[best[i].second] = std::min(slots[best[i].second],
+																(offset + i) | staged_matches_t::fuzzy_flag);
+			offset += batch.size();
+		}
+		return slots;
+	}
+
+	/**
+	 * @brief checks, that report has exactly expected matches of given source
+	 * 
+	 * @return size_t amount of matched reference publications
+	 */
+	inline size_t check_matches(const core::reports::report_t& report, const match_type mt,
+										 const std::vector<size_t>& expected,
+										 const std::vector<std::vector<shared_publication_t>>& batches)
+	{
+		using core::reports::detail::staged_matches_t;
+		std::vector<const shared_publication_t*> joined;
+		for(const auto& batch: batches)
+			for(const auto& pub: batch) joined.push_back(&pub);
+
+		size_t matched = 0ul;
+		for(size_t pos = 0; pos < expected.size(); ++pos)
+		{
+			const auto* found = (*(*report)[pos]())().matched()().data().find(mt);
+			if(expected[pos] == staged_matches_t::npos)
+			{
+				boost::ut::expect(found == nullptr);
+				continue;
+			}
+
+			++matched;
+			const shared_publication_t& pub = *joined[expected[pos] & ~staged_matches_t::fuzzy_flag];
+			boost::ut::expect(found != nullptr && (*found)().data().get() == pub().data().get());
+		}
+		return matched;
+	}
+}	 // namespace summary_tests_values
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite publication_index_tests = [] {
+		using namespace summary_tests_values;
+		using core::reports::detail::publication_index_t;
+		log.info() << "entering `publication_index_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		generator_t gen{};
+		std::vector<shared_publication_t> reference;
+		for(size_t i = 0; i < 400ul; ++i) reference.push_back(random_publication(gen));
+		std::vector<shared_publication_t> input;
+		for(size_t i = 0; i < 200ul; ++i) input.push_back(random_publication(gen));
+		const report_collection_t report = make_report(reference);
+
+		// only part of report is indexed, as in single shard
+		constexpr size_t begin = 100ul;
+		constexpr size_t end	  = 300ul;
+
+		"case_01"_test = [&] {
+			// the same id and title with year in one reference publication gives one candidate
+			const report_collection_t small = make_report(
+				 {make_publication(u"TITLE", 2021, {{id_type::DOI, u"10.1000/a"}}),
+				  make_publication(u"TITLE", 2021, {{id_type::IDT, u"1"}}),
+				  make_publication(u"OTHER", 2021, {{id_type::DOI, u"10.1000/b"}})});
+			publication_index_t index;
+			index.build(small, 0ul, small.size());
+
+			positions_t found;
+			index.lookup(*make_publication(u"TITLE", 2021,
+													 {{id_type::DOI, u"10.1000/a"}, {id_type::IDT, u"1"}})(),
+							 found);
+			ut::expect(found == positions_t{0ul, 1ul});
+
+			index.lookup(*make_publication(u"TITLE", 2020, {{id_type::DOI, u"10.1000/b"}})(), found);
+			ut::expect(found == positions_t{2ul});
+
+			index.lookup(*make_publication(u"NONE", 2021, {{id_type::EID, u"10.1000/a"}})(), found);
+			ut::expect(found.empty());
+		};
+
+		"case_02"_test = [&] {
+			publication_index_t index;
+			index.build(report, begin, end);
+
+			positions_t found;
+			for(const auto& pub: input)
+			{
+				index.lookup(*pub(), found);
+				ut::expect(found == scan(report, begin, end, *pub()));
+			}
+		};
+
+		"case_03"_test = [&] {
+			// every equal publication has to be a candidate
+			publication_index_t index;
+			index.build(report, begin, end);
+
+			positions_t found;
+			for(const auto& pub: input)
+			{
+				index.lookup(*pub(), found);
+				for(size_t pos = begin; pos < end; ++pos)
+					if(reference_at(report, pos)().compare((*pub())()) == 0)
+						ut::expect(std::binary_search(found.begin(), found.end(), pos));
+			}
+		};
+
+		"case_04"_test = [&] {
+			// index extended with `insert` finds the same candidates as built at once
+			publication_index_t built, extended;
+			built.build(report, begin, end);
+			extended.build(report, begin, begin + (end - begin) / 2ul);
+			for(size_t pos = begin + (end - begin) / 2ul; pos < end; ++pos)
+				extended.insert(reference_at(report, pos), pos);
+
+			positions_t lhs, rhs;
+			for(const auto& pub: input)
+			{
+				built.lookup(*pub(), lhs);
+				extended.lookup(*pub(), rhs);
+				ut::expect(lhs == rhs);
+
+				built.lookup_similar(*pub(), 0.2, lhs);
+				extended.lookup_similar(*pub(), 0.2, rhs);
+				std::sort(lhs.begin(), lhs.end());
+				std::sort(rhs.begin(), rhs.end());
+				ut::expect(lhs == rhs);
+			}
+		};
+
+		"case_05"_test = [&] {
+			publication_index_t index;
+			index.build(report, begin, end);
+
+			positions_t found;
+			for(const double ratio: {0.1, 0.2, 0.3})
+				for(const auto& pub: input)
+				{
+					index.lookup_similar(*pub(), ratio, found);
+					std::sort(found.begin(), found.end());
+					ut::expect(std::adjacent_find(found.begin(), found.end()) == found.end());
+
+					const size_t length = (*pub())().title()()->size();
+					for(size_t pos = begin; pos < end; ++pos)
+					{
+						const publication_t& ref = reference_at(report, pos);
+						const bool listed = std::binary_search(found.begin(), found.end(), pos);
+						if(ref().year() != (*pub())().year())
+						{
+							ut::expect(!listed);
+							continue;
+						}
+
+						// every title, that can be close enough, has to be checked
+						const size_t ref_length = ref().title()()->size();
+						const size_t difference
+							 = std::max(length, ref_length) - std::min(length, ref_length);
+						if(difference <= core::reports::fuzzy::max_distance(length, ref_length, ratio))
+							ut::expect(listed);
+					}
+				}
+		};
+	};
+
+	const ut::suite summary_tests = [] {
+		using namespace summary_tests_values;
+		using core::reports::summary;
+		log.info() << "entering `summary_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		constexpr double ratio				  = 0.2;
+		constexpr size_t staged_matches_flag = core::reports::detail::staged_matches_t::fuzzy_flag;
+
+		// publications from other year only fills report, so it is split into many shards
+		generator_t gen{};
+		std::vector<shared_publication_t> filling;
+		for(size_t i = 0; i < 1200ul; ++i)
+		{
+			filling.push_back(random_publication(gen));
+			(*filling.back()())().year(2000);
+		}
+
+		const auto run = [&](const std::vector<shared_publication_t>& reference,
+									const std::vector<std::vector<shared_publication_t>>& orcid,
+									const std::vector<std::vector<shared_publication_t>>& scopus) {
+			core::reports::report_t report{};
+			{
+				summary sum{std::make_shared<patterns::thread_pool>(4ul)};
+				sum.fuzzy_ratio(ratio);
+				sum.on_done.register_slot([&](core::reports::report_t ptr) { report = ptr; });
+				sum.activate(reference);
+
+				// both sources at once, as in engine
+				std::jthread scopus_thread{[&] {
+					for(const auto& batch: scopus) sum.process(batch, match_type::SCOPUS);
+				}};
+				for(const auto& batch: orcid) sum.process(batch, match_type::ORCID);
+			}
+			return report;
+		};
+
+		"case_01"_test = [&] {
+			// hand made cases, at beginning and end of report, so they are in different shards
+			std::vector<shared_publication_t> reference{
+				 make_publication(u"ANALIZAPRZEPLYWU", 2021, {{id_type::DOI, u"10.1000/a"}}),
+				 make_publication(u"BADANIEODPORNOSCI", 2021, {{id_type::IDT, u"1"}}),
+				 make_publication(u"DOKUMENTACJA", 2021, {{id_type::IDT, u"4"}})};
+			reference.insert(reference.end(), filling.begin(), filling.end());
+			reference.push_back(make_publication(u"DOKUMENTACJA", 2021, {{id_type::IDT, u"5"}}));
+			reference.push_back(make_publication(u"CHARAKTERYSTYKA", 2021, {{id_type::IDT, u"2"}}));
+			const size_t last = reference.size() - 1ul;
+
+			const std::vector<std::vector<shared_publication_t>> orcid{
+				 {
+					  with_typos(reference[1], {3}, {}),			 // fuzzy, replaced in next batch
+					  copy_of(reference[0]),						 // exact
+					  copy_of(reference[0]),						 // exact, but later
+					  with_typos(reference[last], {1, 5}, {}),	 // fuzzy, two typos
+					  with_typos(reference[last], {7}, {}),		 // fuzzy, closer but later
+				 },
+				 {
+					  copy_of(reference[1]),						 // exact replaces fuzzy
+					  with_typos(reference[2], {4}, {}),	 // equally close to two, first wins
+				 }};
+			const std::vector<std::vector<shared_publication_t>> scopus{
+				 {with_typos(reference[0], {2}, {{id_type::DOI, u"10.1000/b"}}),	// other id
+				  with_typos(reference[1], {2}, {{id_type::EID, u"3"}})}};
+
+			const core::reports::report_t report = run(reference, orcid, scopus);
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(ut::fatal(ut::eq(report->size(), reference.size())));
+
+			const auto expected_orcid = sequential_matches(reference, orcid, ratio);
+			ut::expect(ut::eq(expected_orcid[0], 1ul));
+			ut::expect(ut::eq(expected_orcid[1], 5ul));
+			ut::expect(ut::eq(expected_orcid[2], 6ul | staged_matches_flag));
+			ut::expect(ut::eq(expected_orcid[last], 3ul | staged_matches_flag));
+			ut::expect(ut::eq(check_matches(report, match_type::ORCID, expected_orcid, orcid), 4ul));
+
+			const auto expected_scopus = sequential_matches(reference, scopus, ratio);
+			ut::expect(ut::eq(expected_scopus[1], 1ul | staged_matches_flag));
+			ut::expect(
+				 ut::eq(check_matches(report, match_type::SCOPUS, expected_scopus, scopus), 1ul));
+		};
+
+		"case_02"_test = [&] {
+			// random publications, inputs are mostly changed copies of reference
+			std::vector<shared_publication_t> reference;
+			for(size_t i = 0; i < 600ul; ++i) reference.push_back(random_publication(gen));
+			reference.insert(reference.end(), filling.begin(), filling.end());
+
+			const auto make_batches = [&](const size_t count, const size_t size) {
+				std::vector<std::vector<shared_publication_t>> result(count);
+				for(auto& batch: result)
+					for(size_t i = 0; i < size; ++i)
+					{
+						const shared_publication_t& source = reference[gen.below(600ul)];
+						const size_t kind						  = gen.below(4ul);
+						if(kind == 0ul) batch.push_back(copy_of(source));
+						else if(kind == 1ul)
+							batch.push_back(with_typos(source, {gen.below(8ul)}, {}));
+						else if(kind == 2ul)
+							batch.push_back(with_typos(source, {gen.below(8ul)}, {{id_type::EID, u"1"}}));
+						else
+							batch.push_back(random_publication(gen));
+					}
+				return result;
+			};
+			const auto orcid	= make_batches(4ul, 50ul);
+			const auto scopus = make_batches(1ul, 150ul);
+
+			const core::reports::report_t report = run(reference, orcid, scopus);
+			ut::expect(ut::fatal(report.get() != nullptr));
+			ut::expect(ut::fatal(ut::eq(report->size(), reference.size())));
+
+			const auto expected_orcid  = sequential_matches(reference, orcid, ratio);
+			const auto expected_scopus = sequential_matches(reference, scopus, ratio);
+			ut::expect(check_matches(report, match_type::ORCID, expected_orcid, orcid) > 0ul);
+			ut::expect(check_matches(report, match_type::SCOPUS, expected_scopus, scopus) > 0ul);
+		};
+	};
+}	 // namespace tests
@@ -0,0 +1,53 @@
+/**
+ * @file thread_pool.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks pool of worker threads
+*/
+
+// STL
+#include <atomic>
+#include <stdexcept>
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/libraries/patterns/thread_pool.hpp>
+
+// using namespace core;core::
+using ::logger;
+
+namespace tests
+{
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite thread_pool_tests = [] {
+		log.info() << "entering `thread_pool_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+
+		"case_01"_test = [] {
+			patterns::thread_pool pool{4ul};
+			std::atomic<size_t> sum{0ul};
+			pool.parallel_for(100ul, [&](const size_t i) { sum += i; });
+			ut::expect(ut::eq(sum.load(), 4950ul));
+		};
+
+		"case_02"_test = [] {
+			patterns::thread_pool pool{4ul};
+			std::atomic<size_t> calls{0ul};
+
+			// every call is finished, before first exception is passed to caller
+			ut::expect(ut::throws<std::runtime_error>([&] {
+				pool.parallel_for(100ul, [&](const size_t i) {
+					++calls;
+					if(i % 10ul == 0ul) throw std::runtime_error{"failed"};
+				});
+			}));
+			ut::expect(ut::eq(calls.load(), 100ul));
+
+			// pool is still usable
+			std::atomic<size_t> sum{0ul};
+			pool.parallel_for(10ul, [&](const size_t i) { sum += i; });
+			ut::expect(ut::eq(sum.load(), 45ul));
+		};
+	};
+}	 // namespace tests
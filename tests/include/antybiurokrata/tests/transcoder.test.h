@@ -0,0 +1,69 @@
+/**
+ * @file transcoder.test.h
+ * @author Krzysztof Mochocki (raidgar98@onet.pl)
+ * @brief theese tests checks conversions between UTF-8 and UTF-16
+*/
+
+// Project includes
+#include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/transcoder.hpp>
+
+namespace transcoder_tests_values
+{
+	constexpr core::str_v polish_01{"Zażółć gęślą jaźń"};
+	constexpr core::u16str_v polish_01_w{u"Zażółć gęślą jaźń"};
+
+	// longer than one block of fast path, with non-ascii character inside second block
+	constexpr core::str_v mixed_01{"Analysis of the method for dynamic ćwiczenia 😀 systems"};
+	constexpr core::u16str_v mixed_01_w{u"Analysis of the method for dynamic ćwiczenia 😀 systems"};
+
+	constexpr core::str_v invalid_01{"abc\xC0\x80"};
+	constexpr core::str_v truncated_01{"abc\xC4"};
+
+	// C0 and C1 can only start overlong sequence, so they are invalid even as last byte
+	constexpr core::str_v invalid_02{"b\xC0"};
+	// too short for lead, so it's dropped, even if second byte is not continuation
+	constexpr core::str_v truncated_02{"\xE0\xE5"};
+	constexpr core::str_v truncated_03{"a\xF0\x61"};
+	constexpr core::str_v invalid_03{"a\xF5\x80\x80\x80"};
+	constexpr core::u16str_v invalid_01_w{u"abc\xDC00"};
+}	 // namespace transcoder_tests_values
+
+namespace tests
+{
+	using namespace core;
+	using namespace boost::ut;
+	namespace ut = boost::ut;
+
+	const ut::suite transcoder_tests = [] {
+		log.info() << "entering `transcoder_tests` suite" << logger::endl;
+		logger::switch_log_level_keeper<logger::log_level::NONE> _;
+		using namespace transcoder_tests_values;
+
+		"case_01"_test = [&] {
+			ut::expect(transcoding::to_utf16(polish_01) == polish_01_w);
+			ut::expect(transcoding::to_utf8(polish_01_w) == polish_01);
+			ut::expect(transcoding::to_utf16(mixed_01) == mixed_01_w);
+			ut::expect(transcoding::to_utf8(mixed_01_w) == mixed_01);
+			ut::expect(transcoding::to_utf16("").empty());
+		};
+
+		"case_02"_test = [&] {
+			ut::expect(transcoding::to_utf16(invalid_01) == transcoding::error_utf16);
+			ut::expect(transcoding::to_utf8(invalid_01_w) == transcoding::error_utf8);
+			ut::expect(transcoding::to_utf16(truncated_01) == u16str_v{u"abc"});
+			ut::expect(transcoding::to_utf16(invalid_02) == transcoding::error_utf16);
+			ut::expect(transcoding::to_utf16(truncated_02).empty());
+			ut::expect(transcoding::to_utf16(truncated_03) == u16str_v{u"a"});
+			ut::expect(transcoding::to_utf16(invalid_03) == transcoding::error_utf16);
+		};
+
+		"case_03"_test = [&] {
+			u16str buffer{u"> "};
+			ut::expect(transcoding::append_utf16(polish_01, buffer));
+			ut::expect(buffer == u16str{u"> "} + u16str{polish_01_w});
+			ut::expect(!transcoding::append_utf16(invalid_01, buffer));
+			ut::expect(buffer == u16str{u"> "} + u16str{polish_01_w});
+		};
+	};
+}	 // namespace tests
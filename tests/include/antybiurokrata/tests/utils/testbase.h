@@ -7,6 +7,7 @@
 // Project includes
 #include <antybiurokrata/libraries/logger/logger.h>
 #include <antybiurokrata/types.hpp>
+#include <antybiurokrata/libraries/patterns/binary_serializer.hpp>
 
 namespace core
 {
@@ -30,6 +31,20 @@ namespace core
 			ss >> b;
 			return a() == b();
 		}
+
+		template<typename Any, typename... U>
+		inline bool check_binary_serialization(U&&... u)
+		{
+			using patterns::serial::deserialize_binary;
+			using patterns::serial::serialize_binary;
+
+			std::stringstream ss;
+			Any a{std::forward<U>(u)...};
+			Any b{};
+			ss << serialize_binary{a};
+			ss >> deserialize_binary{b};
+			return a() == b();
+		}
 	}	 // namespace testbase
 }	 // namespace core
 
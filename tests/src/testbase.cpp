@@ -1,13 +1,12 @@
 #include <antybiurokrata/tests/utils/testbase.h>
+#include <antybiurokrata/character_tables.hpp>
+#include <antybiurokrata/transcoder.hpp>
 
 core::str core::testbase::to_upper(const core::str_v& v)
 {
-	auto eng = core::get_conversion_engine();
-	u16str u16result, buffer{eng.from_bytes(v.data())};
-	u16result.reserve(buffer.size());
-	for(const u16char_t c: buffer)
-		u16result += static_cast<u16char_t>(std::toupper(static_cast<wchar_t>(c), core::plPL()));
-	return eng.to_bytes(u16result);
+	u16str buffer{transcoding::to_utf16(v)};
+	for(u16char_t& c: buffer) c = characters::to_upper(c);
+	return transcoding::to_utf8(buffer);
 }
 
 namespace tests
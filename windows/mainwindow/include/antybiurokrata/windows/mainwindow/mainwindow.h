@@ -157,8 +157,10 @@ class MainWindow : public QMainWindow, private Log<MainWindow>
 	 * @param arg1 user input
 	 * @param line line to write corrected output
 	 * @param next place to propagte additional data (if nullptr [default] propagation is ignored)
+	 * @param allow_check_digit if true, last character can be also `X` (check digit of ORCID)
 	 */
-	void normalize_text(const QString& arg1, QLineEdit& line, QLineEdit* next = nullptr);
+	void normalize_text(const QString& arg1, QLineEdit& line, QLineEdit* next = nullptr,
+							  const bool allow_check_digit = false);
 
 	/**
 	 * @brief handles switch of selected relative
@@ -61,7 +61,8 @@ MainWindow::~MainWindow() { delete ui; }
 
 bool MainWindow::handle_signal() const volatile { return this->m_handle_signals.load(); }
 
-void MainWindow::normalize_text(const QString& arg1, QLineEdit& line, QLineEdit* next)
+void MainWindow::normalize_text(const QString& arg1, QLineEdit& line, QLineEdit* next,
+										  const bool allow_check_digit)
 {
 	const size_t cursor = line.cursorPosition();
 	constexpr size_t max_chars{4};
@@ -71,7 +72,11 @@ void MainWindow::normalize_text(const QString& arg1, QLineEdit& line, QLineEdit*
 	size_t i = 0;
 	for(const auto c: arg1)
 	{
+		const bool is_last		  = static_cast<size_t>(new_text.size()) == max_chars - 1;
+		const bool is_check_digit = allow_check_digit && is_last && (c == 'X' || c == 'x');
 		if(c.isDigit()) new_text += c;
+		else if(is_check_digit)
+			new_text += QChar{'X'};
 		if(new_text.size() == max_chars) break;
 		else
 			i++;
@@ -105,7 +110,7 @@ void MainWindow::on_orcid_3_textChanged(const QString& arg1)
 
 void MainWindow::on_orcid_4_textChanged(const QString& arg1)
 {
-	this->normalize_text(arg1, *ui->orcid_4);
+	this->normalize_text(arg1, *ui->orcid_4, nullptr, true);
 }
 
 void MainWindow::set_max_progress(const size_t N) { ui->progress->setMaximum(N); }
@@ -133,6 +138,9 @@ void MainWindow::on_search_button_clicked()
 	set_activation(false);
 
 	const auto format_orcid_num = [](const QLineEdit& line) -> QString {
+		// `X` is check digit, so it's always fourth character, missing digits are not guessed
+		if(line.text().endsWith('X')) return line.text();
+
 		std::stringstream ss;
 		ss << std::setw(4) << std::setfill('0') << line.text().toStdString();
 		return QString::fromStdString(ss.str());
@@ -170,9 +178,9 @@ void MainWindow::on_generate_report_clicked()
 	if(auto* ptr = dynamic_cast<account_widget_item*>(ui->neighbours->itemAt(0, 0)))
 	{
 		core::check_nullptr{ptr->m_person};
-		name = QString::fromStdU16String((*ptr->m_person.lock())().name()().raw).toLower()
+		name = QString::fromStdU16String((*ptr->m_person.lock())().name()().raw.get()).toLower()
 				 + QString("_")
-				 + QString::fromStdU16String((*ptr->m_person.lock())().surname()().raw).toLower()
+				 + QString::fromStdU16String((*ptr->m_person.lock())().surname()().raw.get()).toLower()
 				 + "_raport.xlsx";
 	}
 	m_job.reset(
@@ -286,16 +294,15 @@ void MainWindow::on_neighbours_itemDoubleClicked(QListWidgetItem* item)
 	{
 		check_nullptr{account->m_person};
 		const auto& person = (*account->m_person.lock())();
-		const auto format	 = [](const uint16_t& num) {
-			 std::stringstream ss;
-			 ss << std::setw(4) << std::setfill('0') << num;
-			 return QString::fromStdString(ss.str());
+		const str orcid	 = core::objects::detail::detail_orcid_t::to_string(person.orcid()());
+		const auto format = [&orcid](const size_t word) {
+			return QString::fromStdString(orcid.substr(word * 5ul, 4ul));
 		};
 
-		ui->orcid_1->setText(format(person.orcid()().identifier()[0]));
-		ui->orcid_2->setText(format(person.orcid()().identifier()[1]));
-		ui->orcid_3->setText(format(person.orcid()().identifier()[2]));
-		ui->orcid_4->setText(format(person.orcid()().identifier()[3]));
+		ui->orcid_1->setText(format(0ul));
+		ui->orcid_2->setText(format(1ul));
+		ui->orcid_3->setText(format(2ul));
+		ui->orcid_4->setText(format(3ul));
 
 		ui->tabWidget->setCurrentIndex(0);
 	}
@@ -315,21 +322,21 @@ void MainWindow::on_publications_itemDoubleClicked(QListWidgetItem* item)
 		const auto& pub_ref	 = (*pub.reference()())();
 		const auto& pub_match = pub.matched()().data();
 
-		auto conv = core::get_conversion_engine();
+		using core::transcoding::to_utf8;
 		std::stringstream ss;
-		ss << "Tytuł referencyjny: " << conv.to_bytes(pub_ref.title()().raw) << std::endl
+		ss << "Tytuł referencyjny: " << to_utf8(pub_ref.title()().raw.get()) << std::endl
 			<< std::endl;
 
 		if(!pub_ref.polish_title()()->empty())
-			ss << "Tytuł orginalny: " << conv.to_bytes(pub_ref.polish_title()().raw) << std::endl
+			ss << "Tytuł orginalny: " << to_utf8(pub_ref.polish_title()().raw.get()) << std::endl
 				<< std::endl;
 
 		ss << "Rok: " << pub_ref.year() << std::endl << std::endl;
 
 		for(const auto& pair: pub_ref.ids()().data())
 		{
-			ss << conv.to_bytes(objects::detail::id_type_stringinizer::get(pair.first)) << ": "
-				<< conv.to_bytes(pair.second().raw) << std::endl;
+			ss << to_utf8(objects::detail::id_type_stringinizer::get(pair.first)) << ": "
+				<< to_utf8(pair.second().raw.get()) << std::endl;
 		}
 
 		ss << std::endl;
@@ -345,11 +352,11 @@ void MainWindow::on_publications_itemDoubleClicked(QListWidgetItem* item)
 				ss << "serwisach: ";
 
 			for(const auto& pair: pub_match)
-				ss << conv.to_bytes(trans_t::get(pair().source()().data())) << " ";
+				ss << to_utf8(trans_t::get(pair.first)) << " ";
 		}
 
 		std::unique_ptr<info_dialog> window{new info_dialog{QString::fromStdString(ss.str()), this}};
-		window->setWindowTitle(QString::fromStdU16String(pub_ref.title()().raw));
+		window->setWindowTitle(QString::fromStdU16String(pub_ref.title()().raw.get()));
 		window->exec();
 	}
 	else
@@ -22,7 +22,7 @@ void account_widget_item::display()
 		// creating string
 		core::u16str label{u"["};
 		label += static_cast<core::u16str>(p.orcid()()) + u"] ";
-		label += p.name()().raw + u" " + p.surname()().raw;
+		label += p.name()().raw.get() + u" " + p.surname()().raw.get();
 
 		// style
 		const QBrush brush{list_widget_colors::default_font_color};
@@ -69,7 +69,7 @@ void publication_widget_item::display()
 		QString result = QString::fromStdString(std::to_string(ref.year()));
 		result.insert(0, "[ ");
 		result += " ] ";
-		result += QString::fromStdU16String(ref.title()().raw);
+		result += QString::fromStdU16String(ref.title()().raw.get());
 
 		// validate size
 		const size_t color_level = matched.size();